@@ -66,6 +66,30 @@ juce::AudioProcessorValueTreeState::ParameterLayout AngelGrainAudioProcessor::cr
         true
     ));
 
+    // syncTriplet - Bool (default false): triplet grid for synced onsets
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID { "syncTriplet", 1 },
+        "Triplet",
+        false
+    ));
+
+    // swing - Float (0-100%, default 0): delays every second synced onset by up to half a grid step
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID { "swing", 1 },
+        "Swing",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
+        0.0f,
+        "%"
+    ));
+
+    // grainNote - Choice (default Free): grain size as a note value while synced
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "grainNote", 1 },
+        "Grain Note",
+        juce::StringArray { "Free", "1/64", "1/32", "1/16", "1/8", "1/4", "1/2" },
+        0
+    ));
+
     return layout;
 }
 
@@ -120,9 +144,11 @@ void AngelGrainAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
 
     // Reset scheduler
     samplesSinceLastGrain = 0;
+    syncPpq = 0.0;
     writePosition = 0;
     feedbackSampleL = 0.0f;
     feedbackSampleR = 0.0f;
+    feedbackStage.prepare(sampleRate);
 
     // Calculate initial grain interval from delayTime parameter
     auto* delayTimeParam = parameters.getRawParameterValue("delayTime");
@@ -159,6 +185,10 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
     auto* characterParam = parameters.getRawParameterValue("character");
     auto* chaosParam = parameters.getRawParameterValue("chaos");
     auto* tempoSyncParam = parameters.getRawParameterValue("tempoSync");
+    auto* grainSizeParam = parameters.getRawParameterValue("grainSize");
+    auto* syncTripletParam = parameters.getRawParameterValue("syncTriplet");
+    auto* swingParam = parameters.getRawParameterValue("swing");
+    auto* grainNoteParam = parameters.getRawParameterValue("grainNote");
 
     float delayTimeMs = delayTimeParam->load();
     float mixValue = mixParam->load() / 100.0f;
@@ -166,13 +196,25 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
     float characterAmount = characterParam->load() / 100.0f;
     float chaosAmount = chaosParam->load() / 100.0f;
     bool tempoSyncEnabled = tempoSyncParam->load() > 0.5f;
+    float grainSizeMs = grainSizeParam->load();
+    bool tripletEnabled = syncTripletParam->load() > 0.5f;
+    float swingAmount = swingParam->load() / 100.0f;
+    int grainNoteIndex = static_cast<int>(grainNoteParam->load());
+
+    // Character morphing: density multiplier (1.0 to 4.0)
+    float densityMultiplier = 1.0f + (characterAmount * 3.0f);
+
+    // Tempo sync: single playhead read per block drives every grain timing value below
+    int numSyncOnsets = 0;
+    double samplesPerBeat = 0.0;
 
-    // Tempo sync: quantize delay time to note divisions
     if (tempoSyncEnabled)
     {
         double bpm = 120.0;  // Default BPM
+        bool hostIsPlaying = false;
+        std::optional<double> hostPpq;
 
-        // Query host for tempo
+        // Query host for tempo and musical position
         if (auto* playHead = getPlayHead())
         {
             if (auto position = playHead->getPosition())
@@ -183,14 +225,41 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
                     // Clamp to valid range
                     bpm = juce::jlimit(20.0, 300.0, bpm);
                 }
+
+                hostIsPlaying = position->getIsPlaying();
+                hostPpq = position->getPpqPosition();
             }
         }
 
-        delayTimeMs = quantizeDelayTimeToTempo(delayTimeMs, bpm);
+        // Follow the host while it plays (handles loops and jumps); free-run the grid otherwise
+        if (hostIsPlaying && hostPpq.has_value())
+            syncPpq = *hostPpq;
+
+        delayTimeMs = quantizeDelayTimeToTempo(delayTimeMs, bpm, tripletEnabled);
+
+        // Onset grid: delay division split into whole subdivisions by character
+        samplesPerBeat = currentSampleRate * 60.0 / bpm;
+        double divisionBeats = delayTimeMs * bpm / 60000.0;
+        double gridBeats = divisionBeats / std::round(densityMultiplier);
+        double swingBeats = swingAmount * gridBeats * 0.5;
+
+        numSyncOnsets = computeSyncOnsets(syncPpq, samplesPerBeat, gridBeats, swingBeats, numSamples);
+        syncPpq += static_cast<double>(numSamples) / samplesPerBeat;
     }
 
-    // Character morphing: density multiplier (1.0 to 4.0)
-    float densityMultiplier = 1.0f + (characterAmount * 3.0f);
+    // Per-block grain settings (spawnGrain reads these, never parameters or the playhead)
+    blockChaosAmount = chaosAmount;
+    blockDelaySamples = (delayTimeMs / 1000.0f) * static_cast<float>(currentSampleRate);
+
+    const float grainNoteBeats[] = { 0.0f, 0.0625f, 0.125f, 0.25f, 0.5f, 1.0f, 2.0f };
+    grainNoteIndex = juce::jlimit(0, 6, grainNoteIndex);
+
+    if (tempoSyncEnabled && grainNoteIndex > 0)
+        blockGrainLengthSamples = static_cast<int>(grainNoteBeats[grainNoteIndex] * samplesPerBeat);
+    else
+        blockGrainLengthSamples = static_cast<int>((grainSizeMs / 1000.0f) * currentSampleRate);
+
+    blockGrainLengthSamples = std::max(1, blockGrainLengthSamples);
 
     // Calculate spawn interval in samples from delay time with density adjustment
     float baseIntervalSamples = (delayTimeMs / 1000.0f) * static_cast<float>(currentSampleRate);
@@ -216,6 +285,8 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
     }
 
     // Process sample by sample
+    int nextSyncOnset = 0;
+
     for (int sample = 0; sample < numSamples; ++sample)
     {
         // Mix feedback with input before writing to grain buffer (stereo)
@@ -226,21 +297,33 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
         grainBuffer.pushSample(0, inputWithFeedbackL);
         grainBuffer.pushSample(1, inputWithFeedbackR);
 
-        // Calculate grain interval with chaos timing jitter
-        int currentInterval = nextGrainInterval;
-        if (chaosAmount > 0.01f)
+        if (tempoSyncEnabled)
         {
-            float timingJitter = (random.nextFloat() - 0.5f) * chaosAmount;
-            currentInterval = static_cast<int>(nextGrainInterval * (1.0f + timingJitter));
-            currentInterval = std::max(1, currentInterval);
+            // Synced: spawn exactly on the precomputed grid onsets (no timing jitter)
+            if (nextSyncOnset < numSyncOnsets && syncOnsetSamples[static_cast<size_t>(nextSyncOnset)] == sample)
+            {
+                spawnGrain();
+                ++nextSyncOnset;
+            }
         }
-
-        // Check if we should spawn a new grain
-        samplesSinceLastGrain++;
-        if (samplesSinceLastGrain >= currentInterval && currentInterval > 0)
+        else
         {
-            spawnGrain();
-            samplesSinceLastGrain = 0;
+            // Calculate grain interval with chaos timing jitter
+            int currentInterval = nextGrainInterval;
+            if (chaosAmount > 0.01f)
+            {
+                float timingJitter = (random.nextFloat() - 0.5f) * chaosAmount;
+                currentInterval = static_cast<int>(nextGrainInterval * (1.0f + timingJitter));
+                currentInterval = std::max(1, currentInterval);
+            }
+
+            // Check if we should spawn a new grain
+            samplesSinceLastGrain++;
+            if (samplesSinceLastGrain >= currentInterval && currentInterval > 0)
+            {
+                spawnGrain();
+                samplesSinceLastGrain = 0;
+            }
         }
 
         // Process all active grain voices
@@ -286,18 +369,11 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
             }
         }
 
-        // Apply feedback gain and soft saturation (stereo)
-        float feedbackL = leftOutput * feedbackGain;
-        float feedbackR = rightOutput * feedbackGain;
-
-        // Apply soft saturation (tanh) at high feedback to prevent runaway
-        if (feedbackGain > 0.5f)
-        {
-            feedbackL = std::tanh(feedbackL);
-            feedbackR = std::tanh(feedbackR);
-        }
-        feedbackSampleL = feedbackL;
-        feedbackSampleR = feedbackR;
+        // Apply feedback gain, damping, DC blocking and soft limiting (stereo)
+        // Sample-accurate loop, so the shared stage runs per frame here
+        feedbackSampleL = leftOutput;
+        feedbackSampleR = rightOutput;
+        feedbackStage.processSample(feedbackSampleL, feedbackSampleR, feedbackGain);
 
         // Write to wet buffer
         wetBuffer.setSample(0, sample, leftOutput);
@@ -350,23 +426,15 @@ void AngelGrainAudioProcessor::spawnGrain()
 
     auto& voice = grainVoices[static_cast<size_t>(voiceIndex)];
 
-    // Read parameters
-    auto* grainSizeParam = parameters.getRawParameterValue("grainSize");
-    auto* delayTimeParam = parameters.getRawParameterValue("delayTime");
-    auto* chaosParam = parameters.getRawParameterValue("chaos");
-
-    float grainSizeMs = grainSizeParam->load();
-    float delayTimeMs = delayTimeParam->load();
-    float chaosAmount = chaosParam->load() / 100.0f;  // Normalize to 0.0-1.0
+    // Per-block values computed in processBlock
+    float chaosAmount = blockChaosAmount;
 
-    // Calculate grain length in samples
-    voice.grainLengthSamples = static_cast<int>((grainSizeMs / 1000.0f) * currentSampleRate);
-    if (voice.grainLengthSamples < 1)
-        voice.grainLengthSamples = 1;
+    // Grain length in samples (ms or note value)
+    voice.grainLengthSamples = blockGrainLengthSamples;
 
     // Calculate read position (how far back in the buffer to read)
-    // Read from delayTime back in the buffer
-    float delayTimeSamples = (delayTimeMs / 1000.0f) * static_cast<float>(currentSampleRate);
+    // Read from delayTime (tempo-quantized when synced) back in the buffer
+    float delayTimeSamples = blockDelaySamples;
 
     // Apply position randomization based on chaos
     // Formula: position = basePosition * (1.0 + (random - 0.5) * (chaos / 100) * 0.5)
@@ -485,7 +553,7 @@ int AngelGrainAudioProcessor::findFreeVoice()
     return 0;
 }
 
-float AngelGrainAudioProcessor::quantizeDelayTimeToTempo(float delayTimeMs, double bpm)
+float AngelGrainAudioProcessor::quantizeDelayTimeToTempo(float delayTimeMs, double bpm, bool triplet)
 {
     // Note division mapping at given BPM
     // At 120 BPM: 1/16 = 125ms, 1/8 = 250ms, 1/4 = 500ms, 1/2 = 1000ms, 1 = 2000ms
@@ -493,6 +561,10 @@ float AngelGrainAudioProcessor::quantizeDelayTimeToTempo(float delayTimeMs, doub
 
     double msPerBeat = 60000.0 / bpm;
 
+    // Triplet divisions fit three notes in the space of two
+    if (triplet)
+        msPerBeat *= 2.0 / 3.0;
+
     // Available note divisions (in beats)
     const float noteDivisions[] = {
         0.25f,  // 1/16 note
@@ -522,6 +594,39 @@ float AngelGrainAudioProcessor::quantizeDelayTimeToTempo(float delayTimeMs, doub
     return juce::jlimit(50.0f, 2000.0f, closestMs);
 }
 
+int AngelGrainAudioProcessor::computeSyncOnsets(double ppqStart, double samplesPerBeat, double gridBeats,
+                                                double swingBeats, int numSamples)
+{
+    // Grid slot n sits at n * gridBeats, odd slots pushed late by swingBeats.
+    // Positions are derived from absolute PPQ, so the grid stays locked across loops and jumps.
+    if (gridBeats <= 0.0 || samplesPerBeat <= 0.0)
+        return 0;
+
+    double ppqEnd = ppqStart + static_cast<double>(numSamples) / samplesPerBeat;
+    // Swing is at most half a step, so no slot before the one containing ppqStart can land in this block
+    auto slot = static_cast<juce::int64>(std::floor(ppqStart / gridBeats));
+    int count = 0;
+
+    for (; static_cast<double>(slot) * gridBeats < ppqEnd && count < maxSyncOnsetsPerBlock; ++slot)
+    {
+        double slotPpq = static_cast<double>(slot) * gridBeats + ((slot & 1) != 0 ? swingBeats : 0.0);
+
+        if (slotPpq < ppqStart || slotPpq >= ppqEnd)
+            continue;
+
+        int offset = static_cast<int>((slotPpq - ppqStart) * samplesPerBeat);
+        offset = juce::jlimit(0, numSamples - 1, offset);
+
+        // Rounding can land two slots on one sample at extreme densities; keep one
+        if (count > 0 && syncOnsetSamples[static_cast<size_t>(count - 1)] >= offset)
+            continue;
+
+        syncOnsetSamples[static_cast<size_t>(count++)] = offset;
+    }
+
+    return count;
+}
+
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
 {
     return new AngelGrainAudioProcessor();
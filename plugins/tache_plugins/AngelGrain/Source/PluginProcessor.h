@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "FeedbackStage.h"
 
 // Grain voice structure for polyphonic grain management
 struct GrainVoice
@@ -63,6 +64,16 @@ private:
     int samplesSinceLastGrain = 0;
     int nextGrainInterval = 0;
 
+    // Tempo-synced scheduler (one playhead read per block)
+    double syncPpq = 0.0;  // Grid position in quarter notes, follows host PPQ while playing
+    static constexpr int maxSyncOnsetsPerBlock = 128;
+    std::array<int, maxSyncOnsetsPerBlock> syncOnsetSamples {};  // Onset sample offsets for this block
+
+    // Per-block grain settings (spawnGrain never touches parameters or the host)
+    int blockGrainLengthSamples = 1;
+    float blockDelaySamples = 0.0f;
+    float blockChaosAmount = 0.0f;
+
     // Hann window table for grain envelopes
     static constexpr int windowTableSize = 4096;
     std::array<float, windowTableSize> hannWindow;
@@ -82,6 +93,7 @@ private:
     // Feedback buffer for feedback loop (stereo)
     float feedbackSampleL = 0.0f;
     float feedbackSampleR = 0.0f;
+    FeedbackStage feedbackStage;  // Damping, DC blocking and soft limiting on the feedback path
 
     // Helper methods
     void spawnGrain();
@@ -89,7 +101,8 @@ private:
     int findFreeVoice();
     int selectPitchShift(float chaosAmount);
     float calculatePlaybackRate(int semitones);
-    float quantizeDelayTimeToTempo(float delayTimeMs, double bpm);
+    float quantizeDelayTimeToTempo(float delayTimeMs, double bpm, bool triplet);
+    int computeSyncOnsets(double ppqStart, double samplesPerBeat, double gridBeats, double swingBeats, int numSamples);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AngelGrainAudioProcessor)
 };
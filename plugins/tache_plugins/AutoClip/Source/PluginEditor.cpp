@@ -121,31 +121,22 @@ void AutoClipAudioProcessorEditor::timerCallback()
     float clipThresholdPercent = clipThresholdParam->load();
     float clipThreshold = clipThresholdPercent * 0.01f;  // Convert 0-100% to 0.0-1.0
 
-    // Simple peak detection from last processed buffer
-    // Note: Real implementation would use atomic<float> in processor for thread-safe access
-    // For now, use smoothed approximation based on parameters
+    // Lock-free meter snapshots from the audio thread
+    // PPM ballistics (instant attack, slow release) keep short peaks visible between timer ticks
+    const auto input = processorRef.inputMeter.getSnapshot();
+    const auto output = processorRef.outputMeter.getSnapshot();
+    const float inputPeak = juce::Decibels::decibelsToGain(input.ppmDb, LevelMeter::minimumDb);
+    const float outputPeak = juce::Decibels::decibelsToGain(output.ppmDb, LevelMeter::minimumDb);
 
-    // Estimate input peak (assume normalized signal)
-    float estimatedInputPeak = 0.7f;  // Placeholder - would read from processor
-
-    // Estimate output peak (if clipping, output clamped to threshold)
-    float estimatedOutputPeak = (clipThreshold > 0.01f && clipThreshold < 1.0f)
-                                ? clipThreshold
-                                : estimatedInputPeak;
-
-    // Smooth peaks for visual stability (exponential smoothing)
-    const float smoothingFactor = 0.3f;
-    smoothedInputPeak += (estimatedInputPeak - smoothedInputPeak) * smoothingFactor;
-    smoothedOutputPeak += (estimatedOutputPeak - smoothedOutputPeak) * smoothingFactor;
-
-    // Detect clipping (occurs when threshold < 1.0 and signal would exceed it)
-    bool isClipping = (clipThreshold < 0.99f && estimatedInputPeak > clipThreshold);
+    // Detect clipping (latest input block's true peak exceeds the threshold)
+    bool isClipping = clipThreshold < 0.99f
+                   && input.truePeakDb > juce::Decibels::gainToDecibels(clipThreshold, LevelMeter::minimumDb);
 
     // Send meter data to JavaScript via custom event
     // JavaScript listens for 'meterUpdate' event
     auto meterData = std::make_unique<juce::DynamicObject>();
-    meterData->setProperty("inputPeak", smoothedInputPeak);
-    meterData->setProperty("outputPeak", smoothedOutputPeak);
+    meterData->setProperty("inputPeak", inputPeak);
+    meterData->setProperty("outputPeak", outputPeak);
     meterData->setProperty("isClipping", isClipping);
 
     webView->emitEventIfBrowserIsVisible("meterUpdate", juce::var(meterData.release()));
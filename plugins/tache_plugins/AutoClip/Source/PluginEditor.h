@@ -35,8 +35,6 @@ private:
 
     // Phase 5.3: Metering (send meter data to UI)
     void timerCallback() override;
-    float smoothedInputPeak = 0.0f;
-    float smoothedOutputPeak = 0.0f;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AutoClipAudioProcessorEditor)
 };
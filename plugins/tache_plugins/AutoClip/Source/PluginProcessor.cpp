@@ -65,6 +65,10 @@ void AutoClipAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBloc
     smoothedGain.reset(sampleRate, 0.05);  // 50ms smoothing
     smoothedGain.setCurrentAndTargetValue(1.0f);  // Default gain = 1.0
 
+    // Phase 5.3: Prepare meters (true peak: a clipper's job is inter-sample overs)
+    inputMeter.prepare(sampleRate, samplesPerBlock, getTotalNumOutputChannels(), true);
+    outputMeter.prepare(sampleRate, samplesPerBlock, getTotalNumOutputChannels(), true);
+
     // Phase 4.3: Preallocate original buffer for clip solo
     originalBuffer.setSize(getTotalNumOutputChannels(), samplesPerBlock);
     originalBuffer.clear();
@@ -92,6 +96,9 @@ void AutoClipAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
 
+    // Phase 5.3: Meter input before clipping
+    inputMeter.process(buffer);
+
     // Phase 4.3: Store original signal before processing
     originalBuffer.setSize(numChannels, numSamples, false, false, true);
     for (int channel = 0; channel < numChannels; ++channel)
@@ -166,6 +173,9 @@ void AutoClipAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
             }
         }
     }
+
+    // Phase 5.3: Meter final output
+    outputMeter.process(buffer);
 }
 
 //==============================================================================
@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "LevelMeter.h"
 
 class AutoClipAudioProcessor : public juce::AudioProcessor
 {
@@ -33,6 +34,10 @@ public:
     // Public APVTS for editor binding
     juce::AudioProcessorValueTreeState parameters;
 
+    // Phase 5.3: Input/output metering (true peak, lock-free snapshots read by the editor)
+    LevelMeter inputMeter;
+    LevelMeter outputMeter;
+
 private:
     // Parameter layout creation
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
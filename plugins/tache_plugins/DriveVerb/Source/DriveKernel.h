@@ -0,0 +1,38 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <cmath>
+#include "FastTanh.h"
+
+// Fused drive stage: gain -> saturation -> peak detection in one pass over the data.
+//
+// The saturator is the shared fastTanh (Shared/FastTanh.h), so the loop has no
+// calls or branches and vectorises. Peak uses four partial maxima (vectorises
+// without fast-math).
+struct DriveKernel
+{
+    // In place; returns the absolute peak of the saturated output
+    static float process(float* data, int numSamples, float gain)
+    {
+        float peak[4] { 0.0f, 0.0f, 0.0f, 0.0f };
+        int i = 0;
+
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                const float y = fastTanh(data[i + lane] * gain);
+                data[i + lane] = y;
+                peak[lane] = juce::jmax(peak[lane], std::abs(y));
+            }
+        }
+
+        for (; i < numSamples; ++i)
+        {
+            const float y = fastTanh(data[i] * gain);
+            data[i] = y;
+            peak[0] = juce::jmax(peak[0], std::abs(y));
+        }
+
+        return juce::jmax(juce::jmax(peak[0], peak[1]), juce::jmax(peak[2], peak[3]));
+    }
+};
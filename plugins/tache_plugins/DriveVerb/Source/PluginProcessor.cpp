@@ -58,6 +58,21 @@ juce::AudioProcessorValueTreeState::ParameterLayout DriveVerbAudioProcessor::cre
         1.0f
     ));
 
+    // FREEZE - Hold the reverb tail indefinitely (input to the reverb muted, lossless feedback)
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID { "freeze", 1 },
+        "Freeze",
+        false
+    ));
+
+    // DRIVE OVERSAMPLING - Anti-aliasing for the drive stage (Off/2x/4x, default 2x)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "driveOversampling", 1 },
+        "Drive Oversampling",
+        juce::StringArray { "Off", "2x", "4x" },
+        1
+    ));
+
     return layout;
 }
 
@@ -67,6 +82,12 @@ DriveVerbAudioProcessor::DriveVerbAudioProcessor()
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
+    // Polyphase IIR half-band filters: low latency, cheap (drive sits on the wet path)
+    for (size_t i = 0; i < driveOversamplers.size(); ++i)
+    {
+        driveOversamplers[i] = std::make_unique<juce::dsp::Oversampling<float>>(
+            2, i + 1, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, true);
+    }
 }
 
 DriveVerbAudioProcessor::~DriveVerbAudioProcessor()
@@ -81,26 +102,34 @@ void DriveVerbAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlo
     spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
     spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
 
-    // Prepare reverb
-    reverb.prepare(spec);
+    // Prepare reverb (allocates delay lines for the largest size at this sample rate)
+    reverb.prepare(sampleRate);
 
     // Prepare dry/wet mixer
     dryWetMixer.prepare(spec);
     dryWetMixer.setMixingRule(juce::dsp::DryWetMixingRule::balanced); // Equal-power mixing
 
-    // Prepare drive waveshaper with tanh transfer function (Stage 4.2)
-    driveShaper.prepare(spec);
-    driveShaper.functionToUse = [](float sample) { return std::tanh(sample); };
+    // Prepare drive oversamplers (Stage 4.2)
+    for (auto& oversampler : driveOversamplers)
+    {
+        oversampler->initProcessing(static_cast<size_t>(samplesPerBlock));
+        oversampler->reset();
+    }
+    selectDriveOversampling(static_cast<int>(parameters.getRawParameterValue("driveOversampling")->load()));
 
     // Prepare DJ-style filter (Stage 4.3)
     filterProcessor.prepare(spec);
+
+    // VU meter on the drive output
+    driveMeter.prepare(sampleRate, samplesPerBlock, getTotalNumOutputChannels(), false);
 }
 
 void DriveVerbAudioProcessor::releaseResources()
 {
     reverb.reset();
     dryWetMixer.reset();
-    driveShaper.reset();
+    for (auto& oversampler : driveOversamplers)
+        oversampler->reset();
     filterProcessor.reset();
 }
 
@@ -124,21 +153,17 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     float filterValue = filterParam->load();  // -100% to +100%
     bool isPostMode = filterPositionParam->load() > 0.5f;  // false=PRE, true=POST
 
-    // Update reverb parameters
-    juce::dsp::Reverb::Parameters reverbParams;
-    reverbParams.roomSize = sizeValue / 100.0f;  // Normalize to 0-1
-    reverbParams.damping = 0.5f;                  // Fixed for now (could add parameter later)
-    reverbParams.wetLevel = 1.0f;                 // Full wet (dry/wet mixer handles blend)
-    reverbParams.dryLevel = 0.0f;                 // No dry in reverb (dry/wet mixer handles it)
-    reverbParams.width = 1.0f;                    // Full stereo width
-    reverbParams.freezeMode = 0.0f;               // No freeze
+    // Switch drive oversampling before the dry push so the wet latency matches
+    int driveOversampling = static_cast<int>(parameters.getRawParameterValue("driveOversampling")->load());
+    if (driveOversampling != activeDriveOversampling)
+        selectDriveOversampling(driveOversampling);
 
-    // Map decay time to reverb parameters (decay affects both room size and damping)
-    // Longer decay = larger room + less damping
-    reverbParams.roomSize = juce::jlimit(0.0f, 1.0f, reverbParams.roomSize + (decayValue / 20.0f));
-    reverbParams.damping = juce::jlimit(0.0f, 1.0f, 1.0f - (decayValue / 10.0f));
+    bool freeze = parameters.getRawParameterValue("freeze")->load() > 0.5f;
 
-    reverb.setParameters(reverbParams);
+    // Update reverb parameters: size scales the delay lines, decay is the RT60 in seconds
+    // (feedback gains derived from the RT60 and each line's length)
+    reverb.setParameters(sizeValue / 100.0f, decayValue);
+    reverb.setFreeze(freeze);
 
     // Update dry/wet mix (normalize 0-100% to 0-1)
     dryWetMixer.setWetMixProportion(dryWetValue / 100.0f);
@@ -150,8 +175,10 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     // Push dry signal into mixer
     dryWetMixer.pushDrySamples(block);
 
-    // Process reverb
-    reverb.process(context);
+    // Process reverb (100% wet, in place; dry/wet mixer handles blend)
+    reverb.process(buffer.getWritePointer(0),
+                   buffer.getNumChannels() > 1 ? buffer.getWritePointer(1) : nullptr,
+                   buffer.getNumSamples());
 
     // Stage 4.4: PRE/POST routing - apply drive and filter in different orders
     // PRE mode (filterPosition=0.0): Filter → Drive
@@ -160,55 +187,61 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     if (isPostMode)
     {
         // POST MODE: Drive → Filter (drive affects harmonics, then filter shapes them)
-        applyDrive(block, context, driveValue);
+        applyDrive(block, driveValue);
         applyFilter(block, context, filterValue);
     }
     else
     {
         // PRE MODE: Filter → Drive (filter shapes frequency content, then drive adds harmonics)
         applyFilter(block, context, filterValue);
-        applyDrive(block, context, driveValue);
+        applyDrive(block, driveValue);
     }
 
     // Mix dry and wet signals
     dryWetMixer.mixWetSamples(block);
 }
 
-void DriveVerbAudioProcessor::applyDrive(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float driveValue)
+void DriveVerbAudioProcessor::selectDriveOversampling(int index)
 {
-    // Apply drive to wet signal (Stage 4.2)
-    // Convert dB to linear gain: gain = 10^(dB/20)
-    float driveGain = std::pow(10.0f, driveValue / 20.0f);
+    activeDriveOversampling = juce::jlimit(0, static_cast<int>(driveOversamplers.size()), index);
 
-    // Apply gain before waveshaping (increases saturation with higher drive)
-    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    float latency = 0.0f;
+    if (activeDriveOversampling > 0)
     {
-        auto* channelData = block.getChannelPointer(channel);
-        for (size_t sample = 0; sample < block.getNumSamples(); ++sample)
-        {
-            channelData[sample] *= driveGain;
-        }
+        auto& oversampler = *driveOversamplers[static_cast<size_t>(activeDriveOversampling - 1)];
+        oversampler.reset();
+        latency = oversampler.getLatencyInSamples();
     }
 
-    // Apply tanh waveshaping (tape-like saturation)
-    driveShaper.process(context);
+    // Drive runs on the wet path only: delay the dry signal to match
+    dryWetMixer.setWetLatency(latency);
+}
+
+void DriveVerbAudioProcessor::applyDrive(juce::dsp::AudioBlock<float>& block, float driveValue)
+{
+    // Apply drive to wet signal (Stage 4.2)
+    // Convert dB to linear gain: gain = 10^(dB/20)
+    float driveGain = std::pow(10.0f, driveValue / 20.0f);
+
+    // Upsample (optional), then gain -> saturation -> peak in one fused pass per channel
+    auto* oversampler = activeDriveOversampling > 0
+        ? driveOversamplers[static_cast<size_t>(activeDriveOversampling - 1)].get()
+        : nullptr;
+    auto driveBlock = oversampler != nullptr ? oversampler->processSamplesUp(block) : block;
 
-    // Measure output level for VU meter (after waveshaping)
-    float maxLevel = 0.0f;
-    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    float peak = 0.0f;
+    for (size_t channel = 0; channel < driveBlock.getNumChannels(); ++channel)
     {
-        const float* channelData = block.getChannelPointer(channel);
-        for (size_t sample = 0; sample < block.getNumSamples(); ++sample)
-        {
-            maxLevel = std::max(maxLevel, std::abs(channelData[sample]));
-        }
+        peak = juce::jmax(peak, DriveKernel::process(driveBlock.getChannelPointer(channel),
+                                                     static_cast<int>(driveBlock.getNumSamples()),
+                                                     driveGain));
     }
 
-    // Convert to dB and store atomically
-    float levelDB = maxLevel > 0.0f
-        ? juce::Decibels::gainToDecibels(maxLevel)
-        : -60.0f;
-    driveOutputLevelDB.store(levelDB);
+    if (oversampler != nullptr)
+        oversampler->processSamplesDown(block);
+
+    // VU meter from the kernel's peak (measured at the oversampled rate, no extra pass)
+    driveMeter.pushBlockPeak(peak, static_cast<int>(block.getNumSamples()));
 }
 
 void DriveVerbAudioProcessor::applyFilter(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float filterValue)
@@ -1,6 +1,9 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "LevelMeter.h"
+#include "DriveKernel.h"
+#include "FdnReverb.h"
 
 class DriveVerbAudioProcessor : public juce::AudioProcessor
 {
@@ -33,8 +36,8 @@ public:
     // Public APVTS for editor access (Pattern #11)
     juce::AudioProcessorValueTreeState parameters;
 
-    // VU meter support
-    float getDriveOutputLevel() const { return driveOutputLevelDB.load(); }
+    // VU meter support (dB, floored at -60 for the UI scale)
+    float getDriveOutputLevel() const { return juce::jmax(-60.0f, driveMeter.getSnapshot().peakDb); }
 
 private:
 
@@ -42,22 +45,26 @@ private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
     // DSP Components (Stage 4.1: Core reverb + dry/wet mixing)
-    juce::dsp::Reverb reverb;
-    juce::dsp::DryWetMixer<float> dryWetMixer;
+    // FDN reverb: decay is the RT60 in seconds, lines sized from the sample rate in prepareToPlay
+    FdnReverb reverb;
+    juce::dsp::DryWetMixer<float> dryWetMixer { 64 };  // Max wet latency: drive oversampler (IIR, a few samples)
 
-    // Stage 4.2: Drive saturation
-    juce::dsp::WaveShaper<float> driveShaper;
+    // Stage 4.2: Drive saturation (fused gain/saturate/peak kernel, optional 2x/4x oversampling)
+    // Oversamplers are built up front so switching never allocates on the audio thread
+    std::array<std::unique_ptr<juce::dsp::Oversampling<float>>, 2> driveOversamplers;
+    int activeDriveOversampling = 0;  // 0 = off, 1 = 2x, 2 = 4x
+    void selectDriveOversampling(int index);
 
     // Stage 4.3: DJ-style filter (low-pass/high-pass with center bypass)
     juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> filterProcessor;
     bool previousWasLowPass = false;  // Track filter type transitions
 
     // Stage 4.4: Helper methods for PRE/POST routing
-    void applyDrive(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float driveValue);
+    void applyDrive(juce::dsp::AudioBlock<float>& block, float driveValue);
     void applyFilter(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float filterValue);
 
-    // VU meter - drive output level
-    std::atomic<float> driveOutputLevelDB { -60.0f };
+    // VU meter - drive output level (shared meter, lock-free snapshot)
+    LevelMeter driveMeter;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DriveVerbAudioProcessor)
 };
@@ -218,6 +218,8 @@ Drum808AudioProcessor::Drum808AudioProcessor()
                         .withOutput("Open Hat", juce::AudioChannelSet::stereo(), false))
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
+    chokeGroups.addToGroup(openHatPad, 0, false);
+    chokeGroups.setChokes(closedHatPad, 0);
 }
 
 Drum808AudioProcessor::~Drum808AudioProcessor()
@@ -305,6 +307,69 @@ void Drum808AudioProcessor::releaseResources()
     // Cleanup will be added in Stage 3
 }
 
+void Drum808AudioProcessor::stopPad(int pad)
+{
+    switch (pad)
+    {
+        case kickPad:      kick.stop(); break;
+        case lowTomPad:    lowTom.stop(); break;
+        case midTomPad:    midTom.stop(); break;
+        case clapPad:      clap.stop(); break;
+        case closedHatPad: closedHat.stop(); break;
+        case openHatPad:   openHat.stop(); break;
+        default: break;
+    }
+}
+
+void Drum808AudioProcessor::handleNoteOn(int note, float velocity, float lowTomBaseFreq, float midTomBaseFreq)
+{
+    // Map MIDI notes to voices
+    int pad = -1;
+    if (note == 36)      pad = kickPad;       // C1 → Kick
+    else if (note == 38) pad = clapPad;       // D1 → Clap
+    else if (note == 41) pad = lowTomPad;     // F1 → Low Tom
+    else if (note == 42) pad = closedHatPad;  // F#1 → Closed Hat (CHOKES open hat)
+    else if (note == 45) pad = midTomPad;     // A1 → Mid Tom
+    else if (note == 46) pad = openHatPad;    // A#1 → Open Hat
+
+    if (pad < 0)
+        return;
+
+    // FIRST: Choke (stop immediately) whatever this pad cuts
+    chokeGroups.forEachChoked(pad, [this](int choked) { stopPad(choked); });
+
+    // THEN: Trigger
+    switch (pad)
+    {
+        case kickPad:
+            kick.trigger(velocity);
+            kickTriggered.store(true, std::memory_order_relaxed);
+            break;
+        case clapPad:
+            clap.trigger(velocity);
+            clapTriggered.store(true, std::memory_order_relaxed);
+            break;
+        case lowTomPad:
+            lowTom.trigger(velocity, lowTomBaseFreq);
+            lowTomTriggered.store(true, std::memory_order_relaxed);
+            break;
+        case closedHatPad:
+            closedHat.trigger(velocity);
+            closedHatTriggered.store(true, std::memory_order_relaxed);
+            break;
+        case midTomPad:
+            midTom.trigger(velocity, midTomBaseFreq);
+            midTomTriggered.store(true, std::memory_order_relaxed);
+            break;
+        case openHatPad:
+            openHat.trigger(velocity);
+            openHatTriggered.store(true, std::memory_order_relaxed);
+            break;
+        default:
+            break;
+    }
+}
+
 void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
@@ -394,61 +459,24 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     const float closedHatCenterFreq = 6000.0f + (closedHatTone * 6000.0f); // 6-12 kHz
     const float openHatCenterFreq = 6000.0f + (openHatTone * 6000.0f);
 
-    // Process MIDI messages
-    for (const auto metadata : midiMessages)
-    {
-        auto message = metadata.getMessage();
-
-        if (message.isNoteOn())
-        {
-            int note = message.getNoteNumber();
-            float velocity = message.getVelocity() / 127.0f;
-
-            // Map MIDI notes to voices
-            if (note == 36) // C1 → Kick
-            {
-                kick.trigger(velocity);
-                kickTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 38) // D1 → Clap
-            {
-                clap.trigger(velocity);
-                clapTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 41) // F1 → Low Tom
-            {
-                lowTom.trigger(velocity, lowTomBaseFreq);
-                lowTomTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 42) // F#1 → Closed Hat (CHOKES open hat)
-            {
-                // FIRST: Choke open hat (stop immediately)
-                openHat.stop();
-
-                // THEN: Trigger closed hat
-                closedHat.trigger(velocity);
-                closedHatTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 45) // A1 → Mid Tom
-            {
-                midTom.trigger(velocity, midTomBaseFreq);
-                midTomTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 46) // A#1 → Open Hat
-            {
-                openHat.trigger(velocity);
-                openHatTriggered.store(true, std::memory_order_relaxed);
-            }
-        }
-    }
-
     // Configure clap filter (outside loop for efficiency)
     clap.bandpassFilter.setCutoffFrequency(clapCenterFreq);
     clap.bandpassFilter.setResonance(clapQ);
 
+    // MIDI is handled at each event's own sample position (triggers and chokes)
+    auto midiIterator = midiMessages.cbegin();
+    const auto midiEnd = midiMessages.cend();
+
     // Synthesize voices (per-sample processing)
     for (int sample = 0; sample < numSamples; ++sample)
     {
+        for (; midiIterator != midiEnd && (*midiIterator).samplePosition <= sample; ++midiIterator)
+        {
+            const auto message = (*midiIterator).getMessage();
+            if (message.isNoteOn())
+                handleNoteOn(message.getNoteNumber(), message.getVelocity() / 127.0f, lowTomBaseFreq, midTomBaseFreq);
+        }
+
         float kickSample = 0.0f;
         float lowTomSample = 0.0f;
         float midTomSample = 0.0f;
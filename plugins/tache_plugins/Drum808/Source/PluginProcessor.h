@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "ChokeGroups.h"
 
 class Drum808AudioProcessor : public juce::AudioProcessor
 {
@@ -43,6 +44,12 @@ public:
 private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
+    // Voice indices for choke groups
+    enum Pad { kickPad = 0, lowTomPad, midTomPad, clapPad, closedHatPad, openHatPad, numPads };
+
+    void handleNoteOn(int note, float velocity, float lowTomBaseFreq, float midTomBaseFreq);
+    void stopPad(int pad);
+
     // Tom Voice structure (used for both Low Tom and Mid Tom)
     struct TomVoice
     {
@@ -159,6 +166,9 @@ private:
     HiHatVoice openHat;
     ClapVoice clap;
 
+    // Closed hat cuts open hat
+    ChokeGroups<numPads> chokeGroups;
+
     double currentSampleRate = 44100.0;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Drum808AudioProcessor)
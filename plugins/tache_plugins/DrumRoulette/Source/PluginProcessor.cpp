@@ -12,7 +12,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout DrumRouletteAudioProcessor::
         false
     ));
 
-    // Per-slot parameters (9 × 8 = 72 parameters)
+    // Per-slot parameters (10 × 8 = 80 parameters)
     for (int slot = 1; slot <= 8; ++slot)
     {
         juce::String slotNum = juce::String(slot);
@@ -89,6 +89,13 @@ juce::AudioProcessorValueTreeState::ParameterLayout DrumRouletteAudioProcessor::
             "Mute " + slotNum,
             false
         ));
+
+        // CHOKE_GROUP_N - 0 = off, 1-4 = slots in the same group cut each other
+        layout.add(std::make_unique<juce::AudioParameterInt>(
+            juce::ParameterID { "CHOKE_GROUP_" + slotNum, 1 },
+            "Choke Group " + slotNum,
+            0, 4, 0
+        ));
     }
 
     return layout;
@@ -140,6 +147,7 @@ DrumRouletteAudioProcessor::DrumRouletteAudioProcessor()
         soloParams[slot] = parameters.getRawParameterValue("SOLO_" + slotNum);
         muteParams[slot] = parameters.getRawParameterValue("MUTE_" + slotNum);
         randomizeParams[slot] = parameters.getRawParameterValue("RANDOMIZE_" + slotNum);
+        chokeGroupParams[slot] = parameters.getRawParameterValue("CHOKE_GROUP_" + slotNum);
 
         // Pass solo/mute pointers to voice
         voice->setSoloMutePointers(soloParams[slot], muteParams[slot], &anySoloActive);
@@ -161,6 +169,7 @@ DrumRouletteAudioProcessor::DrumRouletteAudioProcessor()
     for (int midiNote = 36; midiNote <= 43; ++midiNote)
     {
         synthesiser.addSound(new DrumRouletteSound(midiNote));
+        synthesiser.setNoteMember(midiNote, midiNote - 36);
     }
 }
 
@@ -210,6 +219,17 @@ void DrumRouletteAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
         }
     }
 
+    // Choke groups (applied by the synthesiser at the sample of each note-on)
+    auto& chokeGroups = synthesiser.getChokeGroups();
+    for (int slot = 0; slot < 8; ++slot)
+    {
+        chokeGroups.removeFromGroups(slot);
+
+        const int group = juce::roundToInt(chokeGroupParams[slot]->load());
+        if (group > 0)
+            chokeGroups.addToGroup(slot, group - 1);
+    }
+
     // Get main output buffer (Bus 0)
     auto mainBuffer = getBusBuffer(buffer, false, 0);
 
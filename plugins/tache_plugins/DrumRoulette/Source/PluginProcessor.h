@@ -2,6 +2,7 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_audio_formats/juce_audio_formats.h>
 #include "DrumRouletteVoice.h"
+#include "ChokeGroups.h"
 
 class DrumRouletteAudioProcessor : public juce::AudioProcessor,
                                     public juce::AudioProcessorValueTreeState::Listener
@@ -52,7 +53,7 @@ private:
     void randomizeAllUnlockedSlots();
 
     // DSP Components (declare BEFORE parameters for initialization order)
-    juce::Synthesiser synthesiser;
+    ChokingSynthesiser<8> synthesiser;  // Members are slots 0-7
     juce::AudioFormatManager formatManager;
     std::array<DrumRouletteVoice*, 8> voices;
 
@@ -65,6 +66,7 @@ private:
     std::atomic<float>* muteParams[8] = {};
     std::atomic<float>* randomizeParams[8] = {};
     std::atomic<float>* randomizeAllParam = nullptr;
+    std::atomic<float>* chokeGroupParams[8] = {};
 
     // Phase 4.4: Solo/mute state tracking
     bool anySoloActive = false;
@@ -100,18 +100,18 @@ void FlutterVerbAudioProcessor::prepareToPlay(double sampleRate, int samplesPerB
     int latencySamples = static_cast<int>((baseDelayMs / 1000.0f) * sampleRate);
     dryWetMixer.setWetLatency(latencySamples);
 
-    // Prepare reverb with ProcessSpec
-    reverb.prepare(spec);
-    reverb.reset();
+    // Prepare reverb (delay lines sized for the largest SIZE at this sample rate)
+    reverb.prepare(sampleRate);
 
-    // Phase 4.2: Prepare modulation system
-    modulationDelay.prepare(spec);
-    modulationDelay.reset();
-    modulationDelay.setMaximumDelayInSamples(static_cast<int>(sampleRate * 0.2)); // 200ms max
+    // Phase 4.2: Prepare modulation system (200ms max, sized from the actual sample rate)
+    modulation.prepare(sampleRate, samplesPerBlock, 0.2);
 
-    // Initialize per-channel LFO phase tracking
-    wowPhase.resize(spec.numChannels, 0.0f);
-    flutterPhase.resize(spec.numChannels, 0.0f);
+    // Right channel LFOs start a quarter cycle ahead so wow/flutter differ between channels
+    const float halfPi = juce::MathConstants<float>::halfPi;
+    modulation.setPhases(0.0f, halfPi, 0.0f, halfPi);
+
+    // Phase 5.3: Prepare output meter
+    outputMeter.prepare(sampleRate, samplesPerBlock, getTotalNumOutputChannels(), false);
 
     // Phase 4.3: Prepare filter
     toneFilter.prepare(spec);
@@ -156,27 +156,9 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     auto* modModeParam = parameters.getRawParameterValue("MOD_MODE");
     bool wetDryMode = modModeParam->load() > 0.5f;  // 0=WET_ONLY, 1=WET_DRY
 
-    // Configure reverb parameters with true SIZE/DECAY independence
-    juce::Reverb::Parameters reverbParams;
-
-    // Map SIZE to base room size: 0-100% → 0.2-0.6 (ensures minimum space for reverb)
-    float baseRoomSize = 0.2f + (sizeValue * 0.4f);
-
-    // Map DECAY to multiplier: 0.1-10s → 0.5-2.0x (scales effective room size for tail length)
-    float decayMultiplier = juce::jmap(decayValue, 0.1f, 10.0f, 0.5f, 2.0f);
-
-    // Combine: roomSize affected by both SIZE and DECAY, clamped to valid range
-    reverbParams.roomSize = juce::jlimit(0.1f, 1.0f, baseRoomSize * decayMultiplier);
-
-    // Keep damping for frequency-dependent absorption (complementary control)
-    reverbParams.damping = juce::jmap(decayValue, 0.1f, 10.0f, 0.95f, 0.05f);
-
-    reverbParams.width = 1.0f;         // Full stereo
-    reverbParams.freezeMode = 0.0f;    // No freeze
-    reverbParams.wetLevel = 1.0f;      // Full wet (mixer handles blend)
-    reverbParams.dryLevel = 0.0f;      // No dry (mixer handles blend)
-
-    reverb.setParameters(reverbParams);
+    // Configure reverb: SIZE scales the delay-line lengths, DECAY is the RT60 in seconds
+    // (independent: line gains are derived from each line's length and the RT60)
+    reverb.setParameters(sizeValue, decayValue);
 
     // Set dry/wet mix proportion
     dryWetMixer.setWetMixProportion(mixValue);
@@ -188,65 +170,28 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     auto applyModulation = [&]() {
         if (ageValue > 0.0f)  // Only apply modulation if AGE > 0
         {
-            const int numChannels = buffer.getNumChannels();
-            const int numSamples = buffer.getNumSamples();
-
             // LFO configuration
             const float wowFreqHz = 1.0f;      // Center frequency: 1Hz (range 0.5-1.5Hz)
             const float flutterFreqHz = 6.0f;  // Center frequency: 6Hz (range 4-8Hz)
             const float baseDelayMs = 50.0f;   // Base delay: 50ms
             const float maxModDepth = 0.2f;    // ±20% at AGE=100%
 
-            // Calculate phase increments (radians per sample)
-            const float wowPhaseInc = (wowFreqHz * 2.0f * juce::MathConstants<float>::pi) / static_cast<float>(currentSampleRate);
-            const float flutterPhaseInc = (flutterFreqHz * 2.0f * juce::MathConstants<float>::pi) / static_cast<float>(currentSampleRate);
-
-            // Process each channel
-            for (int channel = 0; channel < numChannels; ++channel)
-            {
-                auto* channelData = buffer.getWritePointer(channel);
-
-                for (int sample = 0; sample < numSamples; ++sample)
-                {
-                    // Calculate wow LFO output (sine wave)
-                    float wowOutput = std::sin(wowPhase[channel]);
-
-                    // Calculate flutter LFO output (sine wave)
-                    float flutterOutput = std::sin(flutterPhase[channel]);
-
-                    // Combine modulation signals (both contribute to pitch variation)
-                    float totalModulation = (wowOutput + flutterOutput) * 0.5f;  // Average to keep in ±1.0 range
-
-                    // Fix 3: Scale by AGE parameter with exponential curve for more usable range
-                    // Exponential scaling gives more control in 0-50% range, still reaches extremes at 100%
-                    float scaledAge = ageValue * ageValue;  // Exponential response
-                    totalModulation *= scaledAge;
-
-                    // Calculate modulated delay time in samples
-                    float baseDelaySamples = (baseDelayMs / 1000.0f) * static_cast<float>(currentSampleRate);
-                    float modulationAmount = baseDelaySamples * maxModDepth * totalModulation;  // ±20% depth
-                    float delayTimeSamples = baseDelaySamples + modulationAmount;
-
-                    // Ensure delay time is within valid range
-                    delayTimeSamples = juce::jlimit(1.0f, static_cast<float>(currentSampleRate * 0.2), delayTimeSamples);
-
-                    // Set delay time for this channel
-                    modulationDelay.setDelay(static_cast<float>(delayTimeSamples));
-
-                    // Process sample through delay line
-                    modulationDelay.pushSample(channel, channelData[sample]);
-                    channelData[sample] = modulationDelay.popSample(channel);
-
-                    // Update LFO phases with wrapping
-                    wowPhase[channel] += wowPhaseInc;
-                    if (wowPhase[channel] >= 2.0f * juce::MathConstants<float>::pi)
-                        wowPhase[channel] -= 2.0f * juce::MathConstants<float>::pi;
-
-                    flutterPhase[channel] += flutterPhaseInc;
-                    if (flutterPhase[channel] >= 2.0f * juce::MathConstants<float>::pi)
-                        flutterPhase[channel] -= 2.0f * juce::MathConstants<float>::pi;
-                }
-            }
+            // Fix 3: Scale by AGE parameter with exponential curve for more usable range
+            // Exponential scaling gives more control in 0-50% range, still reaches extremes at 100%
+            float scaledAge = ageValue * ageValue;  // Exponential response
+
+            // Wow and flutter are averaged (each contributes half) to keep the sum in ±1.0 range
+            TapeModulator::Settings settings;
+            settings.wowHz = wowFreqHz;
+            settings.flutterHz = flutterFreqHz;
+            settings.baseDelaySamples = (baseDelayMs / 1000.0f) * static_cast<float>(currentSampleRate);
+            settings.wowDepth = maxModDepth * 0.5f * scaledAge;
+            settings.flutterDepth = maxModDepth * 0.5f * scaledAge;
+
+            // Both channels in one pass, each at its own modulated delay
+            modulation.process(buffer.getWritePointer(0),
+                               buffer.getNumChannels() > 1 ? buffer.getWritePointer(1) : nullptr,
+                               buffer.getNumSamples(), settings);
         }
     };
 
@@ -341,9 +286,10 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     // Push dry samples (processed in Mode 1, clean in Mode 0)
     dryWetMixer.pushDrySamples(block);
 
-    // Process reverb using modern DSP API
-    juce::dsp::ProcessContextReplacing<float> context(block);
-    reverb.process(context);
+    // Process reverb (100% wet, in place; mixer handles blend)
+    reverb.process(buffer.getWritePointer(0),
+                   buffer.getNumChannels() > 1 ? buffer.getWritePointer(1) : nullptr,
+                   buffer.getNumSamples());
 
     if (!wetDryMode)
     {
@@ -356,23 +302,8 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     // Mix dry and wet samples
     dryWetMixer.mixWetSamples(block);
 
-    // Fix 5: Calculate peak level for VU meter (after all DSP processing)
-    // Store in dB format directly (like TapeAge pattern)
-    float peakLevel = 0.0f;
-    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
-    {
-        const float* channelData = buffer.getReadPointer(channel);
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
-        {
-            peakLevel = juce::jmax(peakLevel, std::abs(channelData[sample]));
-        }
-    }
-
-    // Convert to dB and store atomically (clamp to -100dB minimum to avoid log(0))
-    float peakDb = peakLevel > 0.00001f
-        ? juce::Decibels::gainToDecibels(peakLevel)
-        : -100.0f;
-    outputLevel.store(peakDb, std::memory_order_relaxed);
+    // Fix 5: Update VU meter (after all DSP processing)
+    outputMeter.process(buffer);
 }
 
 juce::AudioProcessorEditor* FlutterVerbAudioProcessor::createEditor()
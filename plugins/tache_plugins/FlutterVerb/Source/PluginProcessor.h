@@ -1,6 +1,9 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "FdnReverb.h"
+#include "TapeModulator.h"
+#include "LevelMeter.h"
 
 class FlutterVerbAudioProcessor : public juce::AudioProcessor
 {
@@ -37,14 +40,12 @@ private:
     // DSP Components (declare BEFORE parameters for initialization order)
     juce::dsp::ProcessSpec spec;
 
-    // Phase 4.1: Core Reverb Processing
-    juce::dsp::Reverb reverb;
+    // Phase 4.1: Core Reverb Processing (8-line modulated FDN, RT60-accurate DECAY)
+    FdnReverb reverb;
     juce::dsp::DryWetMixer<float> dryWetMixer;
 
-    // Phase 4.2: Modulation System
-    juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> modulationDelay { 9600 }; // 200ms at 48kHz
-    std::vector<float> wowPhase;    // Per-channel wow LFO phase (0-2π)
-    std::vector<float> flutterPhase; // Per-channel flutter LFO phase (0-2π)
+    // Phase 4.2: Modulation System (shared stereo wow/flutter: per-channel read positions, one interleaved loop)
+    TapeModulator modulation;
     double currentSampleRate = 44100.0; // Store sample rate for LFO calculations
 
     // Phase 4.3: Saturation and Filter
@@ -55,9 +56,8 @@ private:
     // APVTS comes AFTER DSP components
     juce::AudioProcessorValueTreeState parameters;
 
-    // Phase 5.3: VU Meter output level tracking (atomic for thread safety)
-    // Fix 5: Store level in dB (like TapeAge) instead of linear gain
-    std::atomic<float> outputLevel { -100.0f };  // Peak level in dB (initialized to silence)
+    // Phase 5.3: VU Meter output level tracking (shared meter, lock-free snapshot)
+    LevelMeter outputMeter;
 
     // Parameter layout creation
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
@@ -65,7 +65,8 @@ private:
 public:
     // VU meter accessor (UI thread reads, audio thread writes)
     // Fix 5: Returns dB value directly
-    float getCurrentOutputLevel() const { return outputLevel.load(std::memory_order_relaxed); }
+    float getCurrentOutputLevel() const { return outputMeter.getSnapshot().peakDb; }
+    LevelMeter::Snapshot getOutputMeter() const { return outputMeter.getSnapshot(); }
 
 private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FlutterVerbAudioProcessor)
@@ -0,0 +1,678 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "FastTanh.h"
+#include "ModulationBus.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// LushPad voice engine, laid out as structure-of-arrays: every per-voice value is
+// an array indexed by voice, so the audio loop runs the same branch-free code on
+// all voices side by side (the compiler maps voices onto SIMD lanes).
+//
+// Rendering is split into sub-blocks of at most controlInterval samples:
+//   - Control rate (once per sub-block): envelope stage logic and the nested
+//     LFOs per voice, then the ModulationBus turns LFO sources into pan/FM/
+//     saturation targets (per-sample linear ramps) and primary LFO rate/depth.
+//   - Audio rate (per sample, across voices): 3 FM-feedback sines (polynomial
+//     sine, no std::sin), rational tanh saturation, TPT state-variable low-pass,
+//     envelope, pan.
+// Note frequency and phase increments are computed once at note-on. The filter
+// cutoff is a per-sample ramp; its coefficient comes from a Pade tan, so audio-rate
+// cutoff modulation costs a few multiplies and one divide per voice.
+//
+// Sounding voices are packed into lanes [0, activeVoices): a finished voice is
+// replaced by the last active one, so every loop only runs over sounding voices.
+// Polyphony (up to maxVoices) counts voices, so unison stacks use several lanes.
+// A stolen note fades out over stealFadeSeconds in its own lane while the new
+// note starts in another.
+//
+// MIDI expression (pitch bend, pressure, slide) is kept per channel, so MPE
+// controllers get per-note control. Once per control step each voice's channel
+// values become ModulationBus sources, ramped like the LFOs: bend -> pitch,
+// pressure -> FM depth and cutoff, slide (CC74) -> cutoff and pan.
+class PadVoiceBank
+{
+public:
+    static constexpr int maxVoices = 32;
+    static constexpr int maxUnison = 4;
+    static constexpr int controlInterval = 32;
+
+    PadVoiceBank()
+    {
+        using Scaling = Bus::Scaling;
+
+        for (int i = 0; i < numLfos; ++i)
+            lfoSource[i] = modulation.addSource(lfoSmoothingSeconds);
+
+        // LFO1: pan (+-30% around centre), LFO2: FM depth (+-20%), LFO3: saturation (+-15%)
+        panDestination = modulation.addDestination(0.0f, 1.0f, Scaling::relative);
+        fmDestination = modulation.addDestination(0.0f, maxFeedback / juce::MathConstants<float>::twoPi, Scaling::relative);
+        saturationDestination = modulation.addDestination(1.0f, 3.0f, Scaling::relative);
+        modulation.addRoute(lfoSource[0], panDestination, 0.6f);
+        modulation.addRoute(lfoSource[1], fmDestination, 0.2f);
+        modulation.addRoute(lfoSource[2], saturationDestination, 0.15f);
+
+        // Expression: bend in octaves, pressure 0-1, slide -1..1 (CC74 centred)
+        bendSource = modulation.addSource(expressionSmoothingSeconds);
+        pressureSource = modulation.addSource(expressionSmoothingSeconds);
+        slideSource = modulation.addSource(expressionSmoothingSeconds);
+
+        pitchDestination = modulation.addDestination(1.0f / 16.0f, 16.0f, Scaling::octaves);
+        cutoffDestination = modulation.addDestination(20.0f, 20000.0f, Scaling::octaves);
+        modulation.setBase(pitchDestination, 1.0f);
+        modulation.addRoute(bendSource, pitchDestination, 1.0f);
+        modulation.addRoute(pressureSource, fmDestination, 1.0f);         // Up to double FM depth
+        modulation.addRoute(pressureSource, cutoffDestination, 1.0f);     // +1 octave
+        modulation.addRoute(slideSource, cutoffDestination, 2.0f);        // +-2 octaves
+        modulation.addRoute(slideSource, panDestination, 0.5f);           // +-50% around the voice's pan
+
+        // Secondary LFOs (3-5) modulate primary speeds +-30%, tertiary (6-8) primary depths +-40%
+        for (int i = 0; i < 3; ++i)
+        {
+            lfoRateDestination[i] = modulation.addDestination(0.0f, 1.0f, Scaling::relative);
+            lfoDepthDestination[i] = modulation.addDestination(0.0f, 2.0f, Scaling::relative);
+            modulation.setBase(lfoDepthDestination[i], 1.0f);
+            modulation.addRoute(lfoSource[3 + i], lfoRateDestination[i], 0.3f);
+            modulation.addRoute(lfoSource[6 + i], lfoDepthDestination[i], 0.4f);
+        }
+    }
+
+    struct BlockParameters
+    {
+        float timbre = 0.35f;          // FM feedback depth and saturation
+        float filterCutoff = 2000.0f;  // Hz, scaled down by up to 50% for soft notes
+    };
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+
+        // Fixed ADSR (300ms / 200ms / 80% / 2000ms), as per-sample linear rates
+        attackRate = static_cast<float>(1.0 / (0.3 * sampleRate));
+        decayRate = static_cast<float>((1.0 - sustainLevel) / (0.2 * sampleRate));
+        releaseSeconds = 2.0f;
+
+        lastCutoff = -1.0f;
+        piOverSampleRate = static_cast<float>(juce::MathConstants<double>::pi / sampleRate);
+        modulation.setRange(cutoffDestination, 20.0f, static_cast<float>(juce::jmin(20000.0, sampleRate * 0.45)));
+        modulation.prepare(sampleRate);
+        reset();
+    }
+
+    void reset()
+    {
+        for (int v = 0; v < maxVoices; ++v)
+            stage[v] = Stage::idle;
+
+        activeVoices = 0;
+        sustainPedal = false;
+        master = {};
+        for (auto& state : channels)
+            state = {};
+    }
+
+    // Voice budget (1-maxVoices) and voices stacked per note (1-maxUnison)
+    void setVoiceLimits(int newPolyphony, int newUnison)
+    {
+        polyphony = juce::jlimit(1, maxVoices, newPolyphony);
+        unison = juce::jlimit(1, maxUnison, newUnison);
+    }
+
+    int getNumActiveVoices() const { return activeVoices; }
+
+    void noteOn(int midiChannel, int midiNote, float velocity, juce::Random& random)
+    {
+        const int stack = juce::jmin(unison, polyphony);
+
+        // Over budget: fade out the oldest notes (whole unison stacks)
+        int sounding = 0;
+        for (int v = 0; v < activeVoices; ++v)
+            sounding += isSounding(v) ? 1 : 0;
+
+        while (sounding + stack > polyphony)
+        {
+            const int faded = fadeOldestNote();
+            if (faded == 0)
+                break;
+            sounding -= faded;
+        }
+
+        const uint64_t group = voiceCounter++;
+        const float level = velocity / std::sqrt(static_cast<float>(stack));
+
+        for (int k = 0; k < stack; ++k)
+        {
+            // Spread -1..1 across the stack: detune and pan offset
+            const float spread = stack > 1 ? 2.0f * static_cast<float>(k) / static_cast<float>(stack - 1) - 1.0f : 0.0f;
+            startVoice(acquireLane(), midiChannel, midiNote, velocity, level, group, spread, random);
+        }
+    }
+
+    // With the sustain pedal down the voice keeps playing until the pedal is released
+    void noteOff(int midiChannel, int midiNote)
+    {
+        for (int v = 0; v < activeVoices; ++v)
+        {
+            if (note[v] == midiNote && channel[v] == midiChannel && isHeld(v))
+            {
+                if (sustainPedal)
+                    sustained[v] = true;
+                else
+                    startRelease(v, Stage::release, releaseSeconds);
+            }
+        }
+    }
+
+    void allNotesOff()
+    {
+        for (int v = 0; v < activeVoices; ++v)
+            if (isHeld(v))
+                startRelease(v, Stage::release, releaseSeconds);
+    }
+
+    void setSustain(bool isDown)
+    {
+        sustainPedal = isDown;
+        if (isDown)
+            return;
+
+        for (int v = 0; v < activeVoices; ++v)
+            if (sustained[v] && isHeld(v))
+                startRelease(v, Stage::release, releaseSeconds);
+    }
+
+    // Expression on an MPE master channel applies to every voice; otherwise to
+    // the voices playing on that channel (which, without MPE, is all of them)
+    void setPitchBend(int midiChannel, float semitones, bool isMasterChannel)
+    {
+        stateFor(midiChannel, isMasterChannel).bendOctaves = semitones / 12.0f;
+    }
+
+    void setPressure(int midiChannel, float pressure, bool isMasterChannel)
+    {
+        stateFor(midiChannel, isMasterChannel).pressure = pressure;
+    }
+
+    // Polyphonic aftertouch
+    void setNotePressure(int midiChannel, int midiNote, float pressure)
+    {
+        for (int v = 0; v < activeVoices; ++v)
+            if (note[v] == midiNote && channel[v] == midiChannel)
+                notePressure[v] = pressure;
+    }
+
+    // slide: CC74 as 0-1, centre 0.5
+    void setSlide(int midiChannel, float slide, bool isMasterChannel)
+    {
+        stateFor(midiChannel, isMasterChannel).slide = slide * 2.0f - 1.0f;
+    }
+
+    // Adds into left/right (right may be nullptr)
+    void render(float* left, float* right, int numSamples, const BlockParameters& params)
+    {
+        if (params.filterCutoff != lastCutoff)
+        {
+            lastCutoff = params.filterCutoff;
+            for (int v = 0; v < activeVoices; ++v)
+                modulation.setBase(cutoffDestination, v, velocityScaledCutoff(v));
+        }
+
+        if (activeVoices == 0)
+            return;
+
+        for (int start = 0; start < numSamples; start += controlInterval)
+        {
+            const int count = juce::jmin(controlInterval, numSamples - start);
+            updateControl(count, params);
+            renderAudio(left + start, right != nullptr ? right + start : nullptr, count);
+        }
+    }
+
+private:
+    static constexpr int numOscillators = 3;
+    static constexpr int numLfos = 9;
+    static constexpr float sustainLevel = 0.8f;
+    static constexpr float outputGain = 0.3f;  // Headroom for stacked voices
+    static constexpr float maxFeedback = 0.4f;  // FM feedback depth in radians
+    static constexpr float stealFadeSeconds = 0.01f;
+    static constexpr float svfDamping = 1.0f / 0.35f;  // 1 / Q
+    static constexpr float unisonDetuneCents = 12.0f;  // Outer voices of a stack
+    static constexpr float unisonPanSpread = 0.25f;     // Outer voices of a stack, around centre
+
+    // LFO output smoothing: the original 0.01 per-sample one-pole at 44.1kHz, as a time constant
+    static constexpr float lfoSmoothingSeconds = 100.0f / 44100.0f;
+    static constexpr float expressionSmoothingSeconds = 0.005f;  // De-zippers 7-bit controllers
+
+    using Bus = ModulationBus<maxVoices>;
+
+    enum class Stage : uint8_t { idle, attack, decay, sustain, release, fade };
+
+    struct ChannelState
+    {
+        float bendOctaves = 0.0f;
+        float pressure = 0.0f;
+        float slide = 0.0f;
+    };
+
+    ChannelState& stateFor(int midiChannel, bool isMasterChannel)
+    {
+        return isMasterChannel ? master : channels[juce::jlimit(1, 16, midiChannel)];
+    }
+
+    // Writes the voice's current expression into the bus sources
+    void writeExpression(int v)
+    {
+        const auto& state = channels[channel[v]];
+        modulation.sourceInput(bendSource)[v] = master.bendOctaves + state.bendOctaves;
+        modulation.sourceInput(pressureSource)[v] = juce::jlimit(0.0f, 1.0f, master.pressure + juce::jmax(state.pressure, notePressure[v]));
+        modulation.sourceInput(slideSource)[v] = juce::jlimit(-1.0f, 1.0f, master.slide + state.slide);
+    }
+
+    bool isHeld(int v) const { return stage[v] == Stage::attack || stage[v] == Stage::decay || stage[v] == Stage::sustain; }
+
+    // Counts against the polyphony budget: not finished (idle lanes wait for the next
+    // control step to be removed) and not already being stolen
+    bool isSounding(int v) const { return stage[v] != Stage::idle && stage[v] != Stage::fade; }
+
+    // Linear release (note-off) or fade (stolen) from the current level to zero over the given time
+    void startRelease(int v, Stage releaseStage, float seconds)
+    {
+        stage[v] = releaseStage;
+        releaseRate[v] = envelope[v] / (seconds * static_cast<float>(sampleRate));
+    }
+
+    // Starts a short fade on every voice of the oldest note that is not already fading.
+    // Returns the number of voices faded.
+    int fadeOldestNote()
+    {
+        int oldest = -1;
+        for (int v = 0; v < activeVoices; ++v)
+            if (isSounding(v) && (oldest < 0 || timestamp[v] < timestamp[oldest]))
+                oldest = v;
+
+        if (oldest < 0)
+            return 0;
+
+        const uint64_t group = timestamp[oldest];
+        int faded = 0;
+        for (int v = 0; v < activeVoices; ++v)
+        {
+            if (timestamp[v] == group && isSounding(v))
+            {
+                startRelease(v, Stage::fade, stealFadeSeconds);
+                ++faded;
+            }
+        }
+
+        return faded;
+    }
+
+    // Next free lane; with every lane in use, reuses a finished lane that has not been
+    // removed yet, else the quietest fading lane
+    int acquireLane()
+    {
+        if (activeVoices < maxVoices)
+            return activeVoices++;
+
+        for (int v = 0; v < maxVoices; ++v)
+            if (stage[v] == Stage::idle)
+                return v;
+
+        int lane = 0;
+        for (int v = 1; v < maxVoices; ++v)
+        {
+            const bool fading = stage[v] == Stage::fade;
+            const bool laneFading = stage[lane] == Stage::fade;
+            if ((fading && ! laneFading) || (fading == laneFading && envelope[v] < envelope[lane]))
+                lane = v;
+        }
+
+        return lane;
+    }
+
+    // Moves a voice into another lane (used to keep active voices packed)
+    void moveVoice(int from, int to)
+    {
+        stage[to] = stage[from];
+        note[to] = note[from];
+        channel[to] = channel[from];
+        sustained[to] = sustained[from];
+        notePressure[to] = notePressure[from];
+        timestamp[to] = timestamp[from];
+        velocityGain[to] = velocityGain[from];
+        voiceLevel[to] = voiceLevel[from];
+        envelope[to] = envelope[from];
+        releaseRate[to] = releaseRate[from];
+        renderEnvelope[to] = renderEnvelope[from];
+        envelopeStep[to] = envelopeStep[from];
+
+        for (int osc = 0; osc < numOscillators; ++osc)
+        {
+            phase[osc][to] = phase[osc][from];
+            increment[osc][to] = increment[osc][from];
+            previousOutput[osc][to] = previousOutput[osc][from];
+        }
+
+        svfState1[to] = svfState1[from];
+        svfState2[to] = svfState2[from];
+
+        for (int i = 0; i < numLfos; ++i)
+        {
+            lfoPhase[i][to] = lfoPhase[i][from];
+            lfoBaseFreq[i][to] = lfoBaseFreq[i][from];
+        }
+
+        modulation.copyLane(from, to);
+    }
+
+    void removeFinishedVoices()
+    {
+        for (int v = 0; v < activeVoices;)
+        {
+            if (stage[v] == Stage::idle)
+                moveVoice(--activeVoices, v);
+            else
+                ++v;
+        }
+    }
+
+    // spread: position in the unison stack, -1..1 (0 without unison)
+    void startVoice(int v, int midiChannel, int midiNote, float velocity, float level, uint64_t group, float spread, juce::Random& random)
+    {
+        stage[v] = Stage::attack;
+        note[v] = midiNote;
+        channel[v] = juce::jlimit(1, 16, midiChannel);
+        sustained[v] = false;
+        notePressure[v] = 0.0f;
+        velocityGain[v] = velocity;
+        voiceLevel[v] = level;
+        timestamp[v] = group;
+        envelope[v] = 0.0f;
+        svfState1[v] = svfState2[v] = 0.0f;
+
+        // f = 440 * 2^((note - 69) / 12 + detune), detuned 0 / +7 / -7 cents, in cycles per sample
+        const double baseFreq = 440.0 * std::pow(2.0, (midiNote - 69) / 12.0 + spread * unisonDetuneCents / 1200.0);
+        constexpr double ratios[numOscillators] { 1.0, 1.00407, 0.99593 };
+        for (int osc = 0; osc < numOscillators; ++osc)
+        {
+            phase[osc][v] = 0.0f;
+            previousOutput[osc][v] = 0.0f;
+            increment[osc][v] = static_cast<float>(baseFreq * ratios[osc] / sampleRate);
+        }
+
+        // Random LFO base frequencies: primary 0.05-0.2Hz, secondary 0.02-0.1Hz, tertiary 0.01-0.05Hz
+        for (int i = 0; i < numLfos; ++i)
+        {
+            const float low = i < 3 ? 0.05f : (i < 6 ? 0.02f : 0.01f);
+            const float high = i < 3 ? 0.2f : (i < 6 ? 0.1f : 0.05f);
+            lfoBaseFreq[i][v] = low + random.nextFloat() * (high - low);
+            lfoPhase[i][v] = 0.0f;
+            modulation.sourceInput(lfoSource[i])[v] = 0.0f;
+        }
+
+        for (int i = 0; i < 3; ++i)
+            modulation.setBase(lfoRateDestination[i], v, lfoBaseFreq[i][v]);
+
+        modulation.setBase(panDestination, v, 0.5f + spread * unisonPanSpread);
+        modulation.setBase(cutoffDestination, v, velocityScaledCutoff(v));
+        writeExpression(v);
+
+        modulation.resetLane(v);
+    }
+
+    // Soft notes darker: cutoff reduced by up to 50%
+    float velocityScaledCutoff(int v) const
+    {
+        return juce::jlimit(20.0f, 20000.0f, lastCutoff * (0.5f + 0.5f * velocityGain[v]));
+    }
+
+    // Envelope level after n samples (exact for the linear segments)
+    float advanceEnvelope(int v, int n)
+    {
+        float level = envelope[v];
+        float remaining = static_cast<float>(n);
+
+        while (remaining > 0.0f)
+        {
+            switch (stage[v])
+            {
+                case Stage::attack:
+                {
+                    const float needed = (1.0f - level) / attackRate;
+                    if (needed > remaining) { level += attackRate * remaining; remaining = 0.0f; }
+                    else { level = 1.0f; remaining -= needed; stage[v] = Stage::decay; }
+                    break;
+                }
+                case Stage::decay:
+                {
+                    const float needed = (level - sustainLevel) / decayRate;
+                    if (needed > remaining) { level -= decayRate * remaining; remaining = 0.0f; }
+                    else { level = sustainLevel; remaining -= needed; stage[v] = Stage::sustain; }
+                    break;
+                }
+                case Stage::sustain:
+                    level = sustainLevel;
+                    remaining = 0.0f;
+                    break;
+                case Stage::release:
+                case Stage::fade:
+                {
+                    const float needed = releaseRate[v] > 0.0f ? level / releaseRate[v] : 0.0f;
+                    if (needed > remaining) { level -= releaseRate[v] * remaining; remaining = 0.0f; }
+                    else { level = 0.0f; remaining = 0.0f; stage[v] = Stage::idle; }
+                    break;
+                }
+                case Stage::idle:
+                default:
+                    level = 0.0f;
+                    remaining = 0.0f;
+                    break;
+            }
+        }
+
+        return level;
+    }
+
+    // Nested LFOs advanced by n samples. Primary rate and depth come from the
+    // bus targets of the previous control step (secondary/tertiary modulation).
+    void advanceLfos(int v, int n)
+    {
+        const float samplesToRadians = juce::MathConstants<float>::twoPi * static_cast<float>(n) / static_cast<float>(sampleRate);
+
+        for (int i = 0; i < numLfos; ++i)
+        {
+            const bool primary = i < 3;
+            const float frequency = primary ? modulation.target(lfoRateDestination[i])[v] : lfoBaseFreq[i][v];
+            const float depth = primary ? modulation.target(lfoDepthDestination[i])[v] : 1.0f;
+
+            lfoPhase[i][v] += frequency * samplesToRadians;
+            if (lfoPhase[i][v] >= juce::MathConstants<float>::twoPi)
+                lfoPhase[i][v] -= juce::MathConstants<float>::twoPi;
+
+            modulation.sourceInput(lfoSource[i])[v] = std::sin(lfoPhase[i][v]) * depth;
+        }
+    }
+
+    void updateControl(int n, const BlockParameters& params)
+    {
+        const float inverseN = 1.0f / static_cast<float>(n);
+
+        // Voices that finished during the previous step ramped to zero; drop them
+        removeFinishedVoices();
+
+        for (int v = 0; v < activeVoices; ++v)
+        {
+            renderEnvelope[v] = envelope[v] * voiceLevel[v];
+            envelope[v] = advanceEnvelope(v, n);
+            envelopeStep[v] = (envelope[v] * voiceLevel[v] - renderEnvelope[v]) * inverseN;
+
+            advanceLfos(v, n);
+            writeExpression(v);
+        }
+
+        // FM feedback in cycles (phase offset of feedback * previous output radians)
+        modulation.setBase(fmDestination, params.timbre * maxFeedback / juce::MathConstants<float>::twoPi);
+        modulation.setBase(saturationDestination, 1.0f + params.timbre * 2.0f);
+        modulation.update(n, activeVoices);
+    }
+
+    // sin(2 * pi * x) for x in cycles, |x| < ~2: round, fold to a quarter wave, odd polynomial.
+    // Branch-free so the voice loop vectorises; max error ~4e-6.
+    static float fastSin(float x)
+    {
+        x -= static_cast<float>(static_cast<int>(x + 2.5f) - 2);                  // [-0.5, 0.5)
+        x = std::copysign(0.25f - std::abs(std::abs(x) - 0.25f), x);               // [-0.25, 0.25]
+
+        const float t = x * juce::MathConstants<float>::twoPi;
+        const float t2 = t * t;
+        return t * (1.0f + t2 * (-1.0f / 6.0f + t2 * (1.0f / 120.0f + t2 * (-1.0f / 5040.0f + t2 * (1.0f / 362880.0f)))));
+    }
+
+    // tan(x) for 0 <= x < ~0.49 pi, Pade [5/4]: relative error < 3e-4 up to 0.49 * fs
+    static float fastTan(float x)
+    {
+        const float x2 = x * x;
+        return x * (945.0f + x2 * (-105.0f + x2)) / (945.0f + x2 * (-420.0f + x2 * 15.0f));
+    }
+
+    static float wrapPhase(float p)
+    {
+        return p - static_cast<float>(static_cast<int>(p));  // p >= 0
+    }
+
+    void renderAudio(float* left, float* right, int n)
+    {
+        alignas(32) float laneOut[maxVoices];
+
+        const int numVoices = activeVoices;
+
+        // Local copies of the bus ramps: the bus resets each ramp to its target on the next
+        // update, so nothing is written back, and the compiler can see they alias nothing
+        struct Ramp
+        {
+            alignas(32) float value[maxVoices];
+            alignas(32) float step[maxVoices];
+        };
+
+        auto loadRamp = [this, numVoices](Ramp& ramp, int destination)
+        {
+            std::copy(modulation.value(destination), modulation.value(destination) + numVoices, ramp.value);
+            std::copy(modulation.step(destination), modulation.step(destination) + numVoices, ramp.step);
+        };
+
+        Ramp pan, fmDepth, satGain, pitch, cutoff;
+        loadRamp(pan, panDestination);
+        loadRamp(cutoff, cutoffDestination);
+        loadRamp(fmDepth, fmDestination);
+        loadRamp(satGain, saturationDestination);
+        loadRamp(pitch, pitchDestination);
+
+        for (int s = 0; s < n; ++s)
+        {
+            // Across active voices, no branches
+            for (int v = 0; v < numVoices; ++v)
+            {
+                const float fm = fmDepth.value[v];
+                const float osc1 = fastSin(phase[0][v] + fm * previousOutput[0][v]);
+                const float osc2 = fastSin(phase[1][v] + fm * previousOutput[1][v]);
+                const float osc3 = fastSin(phase[2][v] + fm * previousOutput[2][v]);
+                previousOutput[0][v] = osc1;
+                previousOutput[1][v] = osc2;
+                previousOutput[2][v] = osc3;
+
+                const float x = fastTanh(satGain.value[v] * (osc1 + osc2 + osc3) * (1.0f / 3.0f));
+
+                // TPT state-variable low-pass (trapezoidal integrators), coefficient per sample
+                const float g = fastTan(cutoff.value[v] * piOverSampleRate);
+                const float a1 = 1.0f / (1.0f + g * (g + svfDamping));
+                const float a2 = g * a1;
+                const float a3 = g * a2;
+                const float v3 = x - svfState2[v];
+                const float v1 = a1 * svfState1[v] + a2 * v3;
+                const float y = svfState2[v] + a2 * svfState1[v] + a3 * v3;
+                svfState1[v] = 2.0f * v1 - svfState1[v];
+                svfState2[v] = 2.0f * y - svfState2[v];
+                cutoff.value[v] += cutoff.step[v];
+
+                laneOut[v] = y * renderEnvelope[v];
+
+                phase[0][v] = wrapPhase(phase[0][v] + increment[0][v] * pitch.value[v]);
+                phase[1][v] = wrapPhase(phase[1][v] + increment[1][v] * pitch.value[v]);
+                phase[2][v] = wrapPhase(phase[2][v] + increment[2][v] * pitch.value[v]);
+                pitch.value[v] += pitch.step[v];
+
+                renderEnvelope[v] += envelopeStep[v];
+                fmDepth.value[v] += fmDepth.step[v];
+                satGain.value[v] += satGain.step[v];
+            }
+
+            float mixL = 0.0f;
+            float mixR = 0.0f;
+            for (int v = 0; v < numVoices; ++v)
+            {
+                mixL += laneOut[v] * (1.0f - pan.value[v]);
+                mixR += laneOut[v] * pan.value[v];
+                pan.value[v] += pan.step[v];
+            }
+
+            left[s] += mixL * outputGain;
+            if (right != nullptr)
+                right[s] += mixR * outputGain;
+        }
+    }
+
+    double sampleRate = 44100.0;
+    uint64_t voiceCounter = 0;
+    int activeVoices = 0;
+    int polyphony = 8;
+    int unison = 1;
+    bool sustainPedal = false;
+    ChannelState master;            // MPE master channel: applies to every voice
+    ChannelState channels[17];      // Indexed by MIDI channel 1-16
+    float lastCutoff = -1.0f;
+    float piOverSampleRate = 0.0f;
+
+    float attackRate = 0.0f;
+    float decayRate = 0.0f;
+    float releaseSeconds = 2.0f;
+
+    // Per-voice state (structure of arrays)
+    Stage stage[maxVoices] {};
+    int note[maxVoices] {};
+    int channel[maxVoices] {};
+    bool sustained[maxVoices] {};       // Note-off arrived while the pedal was down
+    float notePressure[maxVoices] {};   // Polyphonic aftertouch
+    uint64_t timestamp[maxVoices] {};  // Note-on order, shared by a unison stack
+    float velocityGain[maxVoices] {};
+    float voiceLevel[maxVoices] {};      // Velocity scaled for the unison stack
+    float envelope[maxVoices] {};        // Envelope level (without velocity) at the end of the last control step
+    float releaseRate[maxVoices] {};
+
+    alignas(32) float phase[numOscillators][maxVoices] {};
+    alignas(32) float increment[numOscillators][maxVoices] {};
+    alignas(32) float previousOutput[numOscillators][maxVoices] {};
+
+    alignas(32) float renderEnvelope[maxVoices] {};  // Envelope * velocity, ramped per sample
+    alignas(32) float envelopeStep[maxVoices] {};
+
+    alignas(32) float svfState1[maxVoices] {};  // TPT SVF integrator states
+    alignas(32) float svfState2[maxVoices] {};
+
+    // Nested LFOs: phases and base rates per voice, outputs are bus sources
+    Bus modulation;
+    int lfoSource[numLfos] {};
+    int lfoRateDestination[3] {};
+    int lfoDepthDestination[3] {};
+    int panDestination = 0;
+    int fmDestination = 0;
+    int saturationDestination = 0;
+    int bendSource = 0;
+    int pressureSource = 0;
+    int slideSource = 0;
+    int pitchDestination = 0;
+    int cutoffDestination = 0;
+
+    float lfoPhase[numLfos][maxVoices] {};
+    float lfoBaseFreq[numLfos][maxVoices] {};
+};
@@ -30,6 +30,22 @@ juce::AudioProcessorValueTreeState::ParameterLayout LushPadAudioProcessor::creat
         0.4f
     ));
 
+    // polyphony - Int (1 to 32 voices, default: 8). Unison voices count towards it.
+    layout.add(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID { "polyphony", 1 },
+        "Polyphony",
+        1, PadVoiceBank::maxVoices,
+        8
+    ));
+
+    // unison - Int (1 to 4 voices per note, default: 1), detuned +-12 cents and spread in pan
+    layout.add(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID { "unison", 1 },
+        "Unison",
+        1, PadVoiceBank::maxUnison,
+        1
+    ));
+
     return layout;
 }
 
@@ -67,19 +83,7 @@ void LushPadAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     reverbParams.freezeMode = 0.0f;   // No freeze
     reverb.setParameters(reverbParams);
 
-    // Prepare DSP spec for mono per-voice filtering
-    juce::dsp::ProcessSpec voiceSpec;
-    voiceSpec.sampleRate = sampleRate;
-    voiceSpec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    voiceSpec.numChannels = 1;  // Mono per-voice
-
-    // Initialize all voices with filter preparation
-    for (auto& voice : voices)
-    {
-        voice.adsr.setSampleRate(sampleRate);
-        voice.filter.prepare(voiceSpec);
-        voice.reset();
-    }
+    voiceBank.prepare(sampleRate);
 }
 
 void LushPadAudioProcessor::releaseResources()
@@ -87,227 +91,92 @@ void LushPadAudioProcessor::releaseResources()
     // Cleanup will be added in Stage 3 (DSP)
 }
 
-void LushPadAudioProcessor::updateVoiceLFOs(SynthVoice& voice)
+float LushPadAudioProcessor::getPitchBendRange(int channel) const
 {
-    // Update tertiary LFOs first (indices 6-8) - slowest layer, modulate primary depths
-    for (int i = 0; i < 3; ++i)
+    for (const auto& zone : { zoneLayout.getLowerZone(), zoneLayout.getUpperZone() })
     {
-        int lfoIndex = 6 + i;
-        float phaseIncrement = (voice.lfoBaseFreq[lfoIndex] * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-        voice.lfoPhase[lfoIndex] += phaseIncrement;
-
-        // Wrap phase
-        if (voice.lfoPhase[lfoIndex] >= juce::MathConstants<float>::twoPi)
-            voice.lfoPhase[lfoIndex] -= juce::MathConstants<float>::twoPi;
+        if (! zone.isActive())
+            continue;
 
-        // Generate smooth random value using sine wave
-        float targetValue = std::sin(voice.lfoPhase[lfoIndex]);
+        if (zone.isUsingChannelAsMemberChannel(channel))
+            return static_cast<float>(zone.perNotePitchbendRange);
 
-        // One-pole low-pass filter for smoothing
-        voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * 0.01f;
+        if (zone.getMasterChannel() == channel)
+            return static_cast<float>(zone.masterPitchbendRange);
     }
 
-    // Update secondary LFOs (indices 3-5) - middle layer, modulate primary speeds
-    for (int i = 0; i < 3; ++i)
-    {
-        int lfoIndex = 3 + i;
-        float phaseIncrement = (voice.lfoBaseFreq[lfoIndex] * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-        voice.lfoPhase[lfoIndex] += phaseIncrement;
-
-        // Wrap phase
-        if (voice.lfoPhase[lfoIndex] >= juce::MathConstants<float>::twoPi)
-            voice.lfoPhase[lfoIndex] -= juce::MathConstants<float>::twoPi;
-
-        // Generate smooth random value
-        float targetValue = std::sin(voice.lfoPhase[lfoIndex]);
-        voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * 0.01f;
-    }
-
-    // Update primary LFOs (indices 0-2) - fastest layer, modulated by secondary and tertiary
-    for (int i = 0; i < 3; ++i)
-    {
-        int lfoIndex = i;
-        int secondaryIndex = 3 + i;  // Secondary LFO that modulates this primary's speed
-        int tertiaryIndex = 6 + i;   // Tertiary LFO that modulates this primary's depth
-
-        // Speed modulation from secondary LFO (±30%)
-        float speedMod = 1.0f + (voice.lfoSmoothed[secondaryIndex] * 0.3f);
-        float modulatedFreq = voice.lfoBaseFreq[lfoIndex] * speedMod;
-
-        float phaseIncrement = (modulatedFreq * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-        voice.lfoPhase[lfoIndex] += phaseIncrement;
+    return 2.0f;  // Standard +-2 semitones without MPE
+}
 
-        // Wrap phase
-        if (voice.lfoPhase[lfoIndex] >= juce::MathConstants<float>::twoPi)
-            voice.lfoPhase[lfoIndex] -= juce::MathConstants<float>::twoPi;
+bool LushPadAudioProcessor::isMpeMasterChannel(int channel) const
+{
+    for (const auto& zone : { zoneLayout.getLowerZone(), zoneLayout.getUpperZone() })
+        if (zone.isActive() && zone.getMasterChannel() == channel)
+            return true;
 
-        // Depth modulation from tertiary LFO (±40%)
-        float depthMod = 1.0f + (voice.lfoSmoothed[tertiaryIndex] * 0.4f);
+    return false;
+}
 
-        // Generate smooth random value with modulated depth
-        float targetValue = std::sin(voice.lfoPhase[lfoIndex]) * depthMod;
-        voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * 0.01f;
-    }
+void LushPadAudioProcessor::handleMidiEvent(const juce::MidiMessage& message)
+{
+    // Tracks MPE configuration messages (MCM) and per-zone pitch bend ranges
+    zoneLayout.processNextMidiEvent(message);
+
+    const int channel = message.getChannel();
+
+    if (message.isNoteOn())
+        voiceBank.noteOn(channel, message.getNoteNumber(), message.getVelocity() / 127.0f, random);
+    else if (message.isNoteOff())
+        voiceBank.noteOff(channel, message.getNoteNumber());
+    else if (message.isPitchWheel())
+        voiceBank.setPitchBend(channel, static_cast<float>(message.getPitchWheelValue() - 8192) / 8192.0f * getPitchBendRange(channel), isMpeMasterChannel(channel));
+    else if (message.isChannelPressure())
+        voiceBank.setPressure(channel, message.getChannelPressureValue() / 127.0f, isMpeMasterChannel(channel));
+    else if (message.isAftertouch())
+        voiceBank.setNotePressure(channel, message.getNoteNumber(), message.getAfterTouchValue() / 127.0f);
+    else if (message.isSustainPedalOn())
+        voiceBank.setSustain(true);
+    else if (message.isSustainPedalOff())
+        voiceBank.setSustain(false);
+    else if (message.isControllerOfType(74))
+        voiceBank.setSlide(channel, message.getControllerValue() / 127.0f, isMpeMasterChannel(channel));
+    else if (message.isAllNotesOff() || message.isAllSoundOff())
+        voiceBank.allNotesOff();
 }
 
 void LushPadAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
 
-    auto totalNumOutputChannels = getTotalNumOutputChannels();
-
     // Clear output buffer
     buffer.clear();
 
-    // Handle MIDI events (sample-accurate timing)
-    for (const auto metadata : midiMessages)
-    {
-        auto message = metadata.getMessage();
-
-        if (message.isNoteOn())
-        {
-            int note = message.getNoteNumber();
-            float velocity = message.getVelocity() / 127.0f;
-            allocateVoice(note, velocity);
-        }
-        else if (message.isNoteOff())
-        {
-            int note = message.getNoteNumber();
-            releaseVoice(note);
-        }
-    }
-
     // Read parameters (atomic, done once per buffer for efficiency)
-    float timbreValue = parameters.getRawParameterValue("timbre")->load();
-    float filterCutoffValue = parameters.getRawParameterValue("filter_cutoff")->load();
+    PadVoiceBank::BlockParameters voiceParams;
+    voiceParams.timbre = parameters.getRawParameterValue("timbre")->load();
+    voiceParams.filterCutoff = parameters.getRawParameterValue("filter_cutoff")->load();
     float reverbAmountValue = parameters.getRawParameterValue("reverb_amount")->load();
 
-    // Generate audio per-sample
+    voiceBank.setVoiceLimits(static_cast<int>(parameters.getRawParameterValue("polyphony")->load()),
+                             static_cast<int>(parameters.getRawParameterValue("unison")->load()));
+
     const int numSamples = buffer.getNumSamples();
+    float* left = buffer.getWritePointer(0);
+    float* right = getTotalNumOutputChannels() > 1 ? buffer.getWritePointer(1) : nullptr;
 
-    for (int sample = 0; sample < numSamples; ++sample)
+    // Render voices in segments between MIDI events (sample-accurate timing)
+    int position = 0;
+    for (const auto metadata : midiMessages)
     {
-        float mixL = 0.0f;
-        float mixR = 0.0f;
-
-        // Process all active voices
-        for (auto& voice : voices)
-        {
-            if (!voice.active)
-                continue;
-
-            // Update nested LFO system
-            updateVoiceLFOs(voice);
-
-            // Get LFO modulation values
-            float panModulation = voice.lfoSmoothed[0];    // LFO1: -1 to +1 (panning)
-            float fmModulation = voice.lfoSmoothed[1];     // LFO2: -1 to +1 (FM depth)
-            float satModulation = voice.lfoSmoothed[2];    // LFO3: -1 to +1 (saturation)
-
-            // Calculate modulated FM feedback depth
-            float baseFeedbackDepth = timbreValue * 0.4f;
-            float modulatedFeedback = baseFeedbackDepth * (1.0f + fmModulation * 0.2f);  // ±20%
-            modulatedFeedback = juce::jlimit(0.0f, 0.4f, modulatedFeedback);
-
-            // Calculate modulated saturation gain
-            float baseSaturationGain = 1.0f + (timbreValue * 2.0f);
-            float modulatedSaturation = baseSaturationGain * (1.0f + satModulation * 0.15f);  // ±15%
-            modulatedSaturation = juce::jlimit(1.0f, 3.0f, modulatedSaturation);
-
-            // Calculate pan position (0.0 = left, 0.5 = center, 1.0 = right)
-            float panValue = 0.5f + (panModulation * 0.3f);  // ±30% from center
-            panValue = juce::jlimit(0.0f, 1.0f, panValue);
-
-            // Calculate base frequency for this MIDI note
-            // f = 440 * 2^((note - 69) / 12)
-            float baseFreq = 440.0f * std::pow(2.0f, (voice.currentNote - 69) / 12.0f);
-
-            // Detuning ratios
-            // +7 cents: 2^(7/1200) ≈ 1.00407
-            // -7 cents: 2^(-7/1200) ≈ 0.99593
-            float ratio1 = 1.0f;       // Base frequency
-            float ratio2 = 1.00407f;   // +7 cents
-            float ratio3 = 0.99593f;   // -7 cents
-
-            // Generate 3 detuned sine oscillators WITH modulated FM feedback
-            // Formula: sin(phase + modulatedFeedback * previousOutput)
-            float osc1 = std::sin(voice.phase1 + modulatedFeedback * voice.previousOutput1);
-            float osc2 = std::sin(voice.phase2 + modulatedFeedback * voice.previousOutput2);
-            float osc3 = std::sin(voice.phase3 + modulatedFeedback * voice.previousOutput3);
-
-            // Store outputs for next sample's feedback
-            voice.previousOutput1 = osc1;
-            voice.previousOutput2 = osc2;
-            voice.previousOutput3 = osc3;
-
-            // Sum oscillators (average to prevent clipping)
-            float voiceOutput = (osc1 + osc2 + osc3) / 3.0f;
-
-            // Apply modulated harmonic saturation using tanh waveshaping
-            voiceOutput = std::tanh(modulatedSaturation * voiceOutput);
-
-            // Calculate velocity-scaled filter cutoff
-            // Soft notes (low velocity): darker sound (cutoff reduced by 50%)
-            // Hard notes (high velocity): brighter sound (cutoff at parameter value)
-            float velocityScaledCutoff = filterCutoffValue * (0.5f + 0.5f * voice.currentVelocity);
-
-            // Clamp to valid range
-            velocityScaledCutoff = juce::jlimit(20.0f, 20000.0f, velocityScaledCutoff);
-
-            // Update filter coefficients (12dB/octave low-pass, Q=0.35)
-            auto coefficients = juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                currentSampleRate,
-                velocityScaledCutoff,
-                0.35f  // Fixed resonance
-            );
-            *voice.filter.coefficients = *coefficients;
-
-            // Process through filter
-            voiceOutput = voice.filter.processSample(voiceOutput);
-
-            // Apply ADSR envelope
-            float envelope = voice.adsr.getNextSample();
-            voiceOutput *= envelope * voice.currentVelocity;
-
-            // Apply LFO-modulated panning
-            float leftGain = 1.0f - panValue;
-            float rightGain = panValue;
-
-            mixL += voiceOutput * leftGain;
-            mixR += voiceOutput * rightGain;
-
-            // Update oscillator phases
-            float phaseIncrement1 = (baseFreq * ratio1 * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-            float phaseIncrement2 = (baseFreq * ratio2 * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-            float phaseIncrement3 = (baseFreq * ratio3 * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-
-            voice.phase1 += phaseIncrement1;
-            voice.phase2 += phaseIncrement2;
-            voice.phase3 += phaseIncrement3;
-
-            // Wrap phases to [0, 2π] to prevent denormals
-            while (voice.phase1 >= juce::MathConstants<float>::twoPi)
-                voice.phase1 -= juce::MathConstants<float>::twoPi;
-            while (voice.phase2 >= juce::MathConstants<float>::twoPi)
-                voice.phase2 -= juce::MathConstants<float>::twoPi;
-            while (voice.phase3 >= juce::MathConstants<float>::twoPi)
-                voice.phase3 -= juce::MathConstants<float>::twoPi;
-
-            // Mark voice inactive if envelope has finished
-            if (!voice.adsr.isActive())
-            {
-                voice.active = false;
-            }
-        }
-
-        // Write to output buffer (reduce gain to prevent clipping with 8 voices)
-        buffer.setSample(0, sample, mixL * 0.3f);
-        if (totalNumOutputChannels > 1)
-        {
-            buffer.setSample(1, sample, mixR * 0.3f);
-        }
+        const int eventPosition = juce::jlimit(position, numSamples, metadata.samplePosition);
+        voiceBank.render(left + position, right != nullptr ? right + position : nullptr, eventPosition - position, voiceParams);
+        position = eventPosition;
+
+        handleMidiEvent(metadata.getMessage());
     }
 
+    voiceBank.render(left + position, right != nullptr ? right + position : nullptr, numSamples - position, voiceParams);
+
     // Apply global reverb with reverb_amount parameter controlling wet/dry
     juce::dsp::AudioBlock<float> block(buffer);
     juce::dsp::ProcessContextReplacing<float> context(block);
@@ -345,89 +214,6 @@ void LushPadAudioProcessor::setStateInformation(const void* data, int sizeInByte
         parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
-// Voice allocation helper methods
-void LushPadAudioProcessor::allocateVoice(int note, float velocity)
-{
-    // First, try to find a free voice
-    for (auto& voice : voices)
-    {
-        if (!voice.active || !voice.adsr.isActive())
-        {
-            startVoice(voice, note, velocity);
-            return;
-        }
-    }
-
-    // All voices busy - steal the oldest voice
-    SynthVoice* oldest = &voices[0];
-    for (auto& voice : voices)
-    {
-        if (voice.timestamp < oldest->timestamp)
-        {
-            oldest = &voice;
-        }
-    }
-
-    // Gracefully release stolen voice before reusing
-    oldest->adsr.noteOff();
-    startVoice(*oldest, note, velocity);
-}
-
-void LushPadAudioProcessor::releaseVoice(int note)
-{
-    for (auto& voice : voices)
-    {
-        if (voice.active && voice.currentNote == note)
-        {
-            voice.adsr.noteOff();
-        }
-    }
-}
-
-void LushPadAudioProcessor::startVoice(SynthVoice& voice, int note, float velocity)
-{
-    voice.active = true;
-    voice.currentNote = note;
-    voice.currentVelocity = velocity;
-    voice.timestamp = voiceCounter++;
-    voice.phase1 = voice.phase2 = voice.phase3 = 0.0f;
-
-    // Initialize random LFO base frequencies for this voice
-    // Primary LFOs (0-2): 0.05-0.2 Hz
-    for (int i = 0; i < 3; ++i)
-    {
-        voice.lfoBaseFreq[i] = 0.05f + random.nextFloat() * (0.2f - 0.05f);
-    }
-
-    // Secondary LFOs (3-5): 0.02-0.1 Hz
-    for (int i = 3; i < 6; ++i)
-    {
-        voice.lfoBaseFreq[i] = 0.02f + random.nextFloat() * (0.1f - 0.02f);
-    }
-
-    // Tertiary LFOs (6-8): 0.01-0.05 Hz
-    for (int i = 6; i < 9; ++i)
-    {
-        voice.lfoBaseFreq[i] = 0.01f + random.nextFloat() * (0.05f - 0.01f);
-    }
-
-    // Reset LFO phases and smoothed values
-    for (int i = 0; i < 9; ++i)
-    {
-        voice.lfoPhase[i] = 0.0f;
-        voice.lfoSmoothed[i] = 0.0f;
-    }
-
-    // Fixed ADSR parameters (Phase 3.1: not parameter-controlled yet)
-    voice.adsrParams.attack = 0.3f;   // 300ms attack
-    voice.adsrParams.decay = 0.2f;    // 200ms decay
-    voice.adsrParams.sustain = 0.8f;  // 80% sustain level
-    voice.adsrParams.release = 2.0f;  // 2000ms release
-
-    voice.adsr.setParameters(voice.adsrParams);
-    voice.adsr.noteOn();
-}
-
 // Factory function
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
 {
@@ -0,0 +1,337 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "KickWavetable.h"
+
+// Small voice pool for MinimalKick, so a retrigger starts a new voice instead
+// of resetting the one that is still ringing.
+//
+// - Up to maxSounding kicks overlap (808-style tails); the remaining voices are
+//   headroom for stolen notes, which fade out over stealFadeSeconds.
+// - Stealing takes the oldest sounding voice. A new note uses a free voice,
+//   else the quietest fading one.
+// - Pitch sweep: at note-on the voice gets a table of per-sample phase
+//   increments for the whole sweep (base * 2^(sweep * e^(-t / tau)), reaching
+//   0.1% of the sweep at pitchDecaySeconds), then a constant base increment.
+//   The curve itself is cached and only recomputed when sweep/time change.
+// - Body: band-limited wavetable (KickWavetable), mip level picked per block.
+// - Transient layer: a short click sample added at note-on, scaled by
+//   transientLevel (0 = off).
+// - Linear AD amplitude envelope (same shape as juce::ADSR with sustain 0).
+// - Drive (tanh) is applied once to the mono mix, with its gain hoisted per block.
+class KickVoicePool
+{
+public:
+    static constexpr int numVoices = 6;
+    static constexpr int maxSounding = 4;
+    static constexpr double stealFadeSeconds = 0.005;
+    static constexpr double maxPitchDecaySeconds = 0.5;  // "time" parameter maximum
+    static constexpr double transientSeconds = 0.01;
+    static constexpr float maxIncrement = 0.5f;  // Nyquist; keeps the single-subtract phase wrap valid
+
+    // Latched at note-on
+    struct NoteParameters
+    {
+        float attackSeconds = 0.005f;
+        float decaySeconds = 0.4f;
+        float sweepSemitones = 12.0f;
+        float pitchDecaySeconds = 0.05f;
+        int shape = KickWavetable::sine;
+        float transientLevel = 0.0f;  // 0-1
+    };
+
+    // Read once per block
+    struct BlockParameters
+    {
+        float drive = 0.2f;  // 0-1
+    };
+
+    // Message thread (allocates)
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        fadeStep = static_cast<float>(1.0 / (stealFadeSeconds * sampleRate));
+
+        maxSweepLength = static_cast<int>(std::ceil(maxPitchDecaySeconds * sampleRate));
+        sweepRatio.assign(static_cast<size_t>(maxSweepLength), 1.0f);
+        for (auto& table : sweepTables)
+            table.assign(static_cast<size_t>(maxSweepLength), 0.0f);
+        cachedSweepSemitones = cachedPitchDecaySeconds = -1.0f;
+
+        wavetable.prepare(sampleRate);
+        buildTransient();
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& voice : voices)
+            voice = Voice {};
+
+        noteCounter = 0;
+    }
+
+    void noteOn(int midiNoteNumber, const NoteParameters& note)
+    {
+        // Keep at most maxSounding kicks ringing: the oldest one fades out
+        int sounding = 0;
+        Voice* oldest = nullptr;
+
+        for (auto& voice : voices)
+        {
+            if (voice.stage == Stage::idle || voice.fading)
+                continue;
+
+            ++sounding;
+            if (oldest == nullptr || voice.age < oldest->age)
+                oldest = &voice;
+        }
+
+        if (sounding >= maxSounding && oldest != nullptr)
+            oldest->fading = true;
+
+        const size_t index = acquireVoice();
+        Voice& voice = voices[index];
+        voice = Voice {};
+        voice.age = ++noteCounter;
+        voice.shape = note.shape;
+        voice.increment = juce::jmin(maxIncrement, static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(midiNoteNumber) / sampleRate));
+        voice.decayStep = static_cast<float>(1.0 / (juce::jmax(0.0001f, note.decaySeconds) * sampleRate));
+        voice.transientGain = note.transientLevel;
+        voice.transientPosition = note.transientLevel > 0.0f ? 0 : static_cast<int>(transient.size());
+
+        if (note.attackSeconds > 0.0f)
+        {
+            voice.stage = Stage::attack;
+            voice.attackStep = static_cast<float>(1.0 / (note.attackSeconds * sampleRate));
+        }
+        else
+        {
+            voice.stage = Stage::decay;
+            voice.level = 1.0f;
+        }
+
+        // Per-note increment table: cached curve * this note's base increment
+        updateSweepCurve(note.sweepSemitones, note.pitchDecaySeconds);
+        voice.sweepLength = sweepLength;
+        juce::FloatVectorOperations::multiply(sweepTables[index].data(), sweepRatio.data(), voice.increment, sweepLength);
+        juce::FloatVectorOperations::min(sweepTables[index].data(), sweepTables[index].data(), maxIncrement, sweepLength);
+    }
+
+    bool isActive() const
+    {
+        for (const auto& voice : voices)
+            if (voice.stage != Stage::idle)
+                return true;
+
+        return false;
+    }
+
+    // Overwrites output (mono) with the driven mix of all voices
+    void render(float* output, int numSamples, const BlockParameters& block)
+    {
+        juce::FloatVectorOperations::clear(output, numSamples);
+
+        if (numSamples <= 0 || ! isActive())
+            return;
+
+        const float driveGain = 1.0f + block.drive * 9.0f;  // 1.0 to 10.0
+
+        for (size_t index = 0; index < voices.size(); ++index)
+        {
+            if (voices[index].stage == Stage::idle)
+                continue;
+
+            renderTransient(voices[index], output, numSamples);
+            renderBody(voices[index], sweepTables[index].data(), output, numSamples);
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = std::tanh(driveGain * output[i]);
+    }
+
+private:
+    enum class Stage { idle, attack, decay };
+
+    struct Voice
+    {
+        Stage stage = Stage::idle;
+        float level = 0.0f;
+        float attackStep = 0.0f;
+        float decayStep = 0.0f;
+
+        int shape = KickWavetable::sine;
+        float phase = 0.5f;       // Cycles, [0, 1). Starting at 0.5 keeps the old sin(phase - pi) polarity
+        float increment = 0.0f;   // Cycles per sample at the note's base pitch
+        int sweepPosition = 0;
+        int sweepLength = 0;
+
+        int transientPosition = 0;
+        float transientGain = 0.0f;
+
+        bool fading = false;
+        float fadeGain = 1.0f;
+        uint32_t age = 0;
+    };
+
+    size_t acquireVoice()
+    {
+        int quietestFade = -1;
+
+        for (size_t i = 0; i < voices.size(); ++i)
+        {
+            const auto& voice = voices[i];
+            if (voice.stage == Stage::idle)
+                return i;
+
+            if (voice.fading && (quietestFade < 0 || loudness(voice) < loudness(voices[static_cast<size_t>(quietestFade)])))
+                quietestFade = static_cast<int>(i);
+        }
+
+        if (quietestFade >= 0)
+            return static_cast<size_t>(quietestFade);
+
+        // Unreachable with maxSounding < numVoices, kept as a safe fallback
+        size_t oldest = 0;
+        for (size_t i = 1; i < voices.size(); ++i)
+            if (voices[i].age < voices[oldest].age)
+                oldest = i;
+
+        return oldest;
+    }
+
+    static float loudness(const Voice& voice) { return voice.fadeGain * voice.level; }
+
+    void updateSweepCurve(float sweepSemitones, float pitchDecaySeconds)
+    {
+        if (sweepSemitones == cachedSweepSemitones && pitchDecaySeconds == cachedPitchDecaySeconds)
+            return;
+
+        cachedSweepSemitones = sweepSemitones;
+        cachedPitchDecaySeconds = pitchDecaySeconds;
+
+        if (sweepSemitones <= 0.0f)
+        {
+            sweepLength = 0;
+            return;
+        }
+
+        // Envelope falls to 0.1% in pitchDecaySeconds; from there on the pitch is the base pitch
+        const double seconds = juce::jlimit(0.0001, maxPitchDecaySeconds, static_cast<double>(pitchDecaySeconds));
+        sweepLength = juce::jmin(maxSweepLength, static_cast<int>(std::ceil(seconds * sampleRate)));
+
+        const double decayPerSample = std::exp(std::log(0.001) / (seconds * sampleRate));
+        const double octaves = sweepSemitones / 12.0;
+        double envelope = 1.0;
+
+        for (int n = 0; n < sweepLength; ++n)
+        {
+            sweepRatio[static_cast<size_t>(n)] = static_cast<float>(std::exp2(octaves * envelope));
+            envelope *= decayPerSample;
+        }
+    }
+
+    // Deterministic click: decaying noise burst through a first-order high-pass
+    void buildTransient()
+    {
+        const int length = juce::jmax(1, static_cast<int>(transientSeconds * sampleRate));
+        transient.assign(static_cast<size_t>(length), 0.0f);
+
+        const double decayPerSample = std::exp(-1.0 / (0.0015 * sampleRate));
+        uint32_t noise = 0x2545f491u;
+        double envelope = 1.0;
+        float previous = 0.0f;
+        float peak = 0.0f;
+
+        for (auto& sample : transient)
+        {
+            noise ^= noise << 13;
+            noise ^= noise >> 17;
+            noise ^= noise << 5;
+            const float x = static_cast<float>(static_cast<int32_t>(noise)) * (1.0f / 2147483648.0f) * static_cast<float>(envelope);
+
+            sample = x - previous;
+            previous = x;
+            envelope *= decayPerSample;
+            peak = juce::jmax(peak, std::abs(sample));
+        }
+
+        if (peak > 0.0f)
+            juce::FloatVectorOperations::multiply(transient.data(), 1.0f / peak, length);
+    }
+
+    void renderTransient(Voice& voice, float* output, int numSamples)
+    {
+        const int count = juce::jmin(numSamples, static_cast<int>(transient.size()) - voice.transientPosition);
+        if (count <= 0)
+            return;
+
+        juce::FloatVectorOperations::addWithMultiply(output, transient.data() + voice.transientPosition,
+                                                     voice.transientGain * voice.fadeGain, count);
+        voice.transientPosition += count;
+    }
+
+    void renderBody(Voice& voice, const float* increments, float* output, int numSamples)
+    {
+        // Highest frequency in this block is the current one (the sweep only falls)
+        const float currentIncrement = voice.sweepPosition < voice.sweepLength ? increments[voice.sweepPosition] : voice.increment;
+        const float* table = wavetable.get(voice.shape, currentIncrement);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            // Amplitude envelope (linear AD)
+            if (voice.stage == Stage::attack)
+            {
+                voice.level += voice.attackStep;
+                if (voice.level >= 1.0f)
+                {
+                    voice.level = 1.0f;
+                    voice.stage = Stage::decay;
+                }
+            }
+            else
+            {
+                voice.level -= voice.decayStep;
+                if (voice.level <= 0.0f)
+                {
+                    voice = Voice {};
+                    return;
+                }
+            }
+
+            if (voice.fading)
+            {
+                voice.fadeGain -= fadeStep;
+                if (voice.fadeGain <= 0.0f)
+                {
+                    voice = Voice {};
+                    return;
+                }
+            }
+
+            output[i] += KickWavetable::read(table, voice.phase) * voice.level * voice.fadeGain;
+
+            // Table read + accumulate
+            voice.phase += voice.sweepPosition < voice.sweepLength ? increments[voice.sweepPosition++] : voice.increment;
+            voice.phase -= voice.phase >= 1.0f ? 1.0f : 0.0f;
+        }
+    }
+
+    double sampleRate = 44100.0;
+    float fadeStep = 0.0f;
+    uint32_t noteCounter = 0;
+    std::array<Voice, numVoices> voices {};
+
+    KickWavetable wavetable;
+    std::vector<float> transient;
+
+    int maxSweepLength = 0;
+    int sweepLength = 0;
+    float cachedSweepSemitones = -1.0f;
+    float cachedPitchDecaySeconds = -1.0f;
+    std::vector<float> sweepRatio;                           // 2^(octaves * envelope), shared curve
+    std::array<std::vector<float>, numVoices> sweepTables;   // Per-voice phase increments
+};
@@ -0,0 +1,110 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cmath>
+#include <vector>
+
+// Band-limited single-cycle bodies for MinimalKick, mipmapped per octave.
+//
+// Level k holds only the harmonics that stay below 0.45 * sampleRate for
+// fundamentals up to 40Hz * 2^k, so reading the level chosen for the highest
+// frequency in a block cannot alias. Tables are summed from one sine table
+// (harmonic k of sample i is sine[(k * i) mod size]), so building all of them
+// in prepare() is additions only. One guard sample at the end makes linear
+// interpolation branch-free.
+class KickWavetable
+{
+public:
+    enum Shape { sine = 0, triangle, square, saw, numShapes };
+
+    static constexpr int tableSize = 2048;
+    static constexpr int numLevels = 10;        // Top fundamentals 40Hz ... 20.48kHz
+    static constexpr int maxHarmonics = 256;
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+
+        std::array<float, tableSize> sineTable {};
+        for (int i = 0; i < tableSize; ++i)
+            sineTable[static_cast<size_t>(i)] = static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * i / tableSize));
+
+        tables.assign(static_cast<size_t>(numShapes * numLevels * (tableSize + 1)), 0.0f);
+
+        for (int shape = 0; shape < numShapes; ++shape)
+        {
+            for (int level = 0; level < numLevels; ++level)
+            {
+                const double topFrequency = 40.0 * std::pow(2.0, level);
+                const int harmonics = juce::jlimit(1, maxHarmonics, static_cast<int>(0.45 * sampleRate / topFrequency));
+                float* table = tableFor(shape, level);
+
+                for (int k = 1; k <= harmonics; ++k)
+                {
+                    const float amplitude = harmonicAmplitude(shape, k);
+                    if (amplitude == 0.0f)
+                        continue;
+
+                    for (int i = 0; i < tableSize; ++i)
+                        table[i] += amplitude * sineTable[static_cast<size_t>((k * i) & (tableSize - 1))];
+                }
+            }
+
+            // One gain per shape (from the richest level), so switching levels keeps the loudness
+            float peak = 0.0f;
+            for (int i = 0; i < tableSize; ++i)
+                peak = juce::jmax(peak, std::abs(tableFor(shape, 0)[i]));
+
+            const float normalise = peak > 0.0f ? 1.0f / peak : 1.0f;
+            for (int level = 0; level < numLevels; ++level)
+            {
+                float* table = tableFor(shape, level);
+                for (int i = 0; i < tableSize; ++i)
+                    table[i] *= normalise;
+                table[tableSize] = table[0];
+            }
+        }
+    }
+
+    // Table for a phase increment in cycles per sample (the highest one the caller will read at)
+    const float* get(int shape, float increment) const
+    {
+        const double frequency = increment * sampleRate;
+
+        int level = 0;
+        while (level < numLevels - 1 && frequency > 40.0 * (1 << level))
+            ++level;
+
+        return tables.data() + static_cast<size_t>((juce::jlimit(0, numShapes - 1, shape) * numLevels + level) * (tableSize + 1));
+    }
+
+    // phase in cycles, [0, 1)
+    static float read(const float* table, float phase)
+    {
+        const float position = phase * static_cast<float>(tableSize);
+        const int index = static_cast<int>(position);
+        const float fraction = position - static_cast<float>(index);
+        return table[index] + fraction * (table[index + 1] - table[index]);
+    }
+
+private:
+    static float harmonicAmplitude(int shape, int k)
+    {
+        switch (shape)
+        {
+            case triangle: return (k % 2 == 0) ? 0.0f : ((k / 2) % 2 == 0 ? 1.0f : -1.0f) / static_cast<float>(k * k);
+            case square:   return (k % 2 == 0) ? 0.0f : 1.0f / static_cast<float>(k);
+            case saw:      return 1.0f / static_cast<float>(k);
+            case sine:
+            default:       return k == 1 ? 1.0f : 0.0f;
+        }
+    }
+
+    float* tableFor(int shape, int level)
+    {
+        return tables.data() + static_cast<size_t>((shape * numLevels + level) * (tableSize + 1));
+    }
+
+    double sampleRate = 44100.0;
+    std::vector<float> tables;
+};
@@ -50,6 +50,23 @@ juce::AudioProcessorValueTreeState::ParameterLayout MinimalKickAudioProcessor::c
         "%"
     ));
 
+    // body - Band-limited wavetable body shape
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "body", 1 },
+        "Body",
+        juce::StringArray { "Sine", "Triangle", "Square", "Saw" },
+        0
+    ));
+
+    // transient - Click sample layer level (0.0 to 100.0%, 0 = off)
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID { "transient", 1 },
+        "Transient",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f),
+        0.0f,
+        "%"
+    ));
+
     return layout;
 }
 
@@ -58,8 +75,6 @@ MinimalKickAudioProcessor::MinimalKickAudioProcessor()
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
-    // Initialize oscillator with sine wave
-    oscillator.initialise([](float x) { return std::sin(x); }, 128);
 }
 
 MinimalKickAudioProcessor::~MinimalKickAudioProcessor()
@@ -70,22 +85,33 @@ void MinimalKickAudioProcessor::prepareToPlay(double sampleRate, int samplesPerB
 {
     this->sampleRate = sampleRate;
 
-    // Prepare oscillator
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
-
-    oscillator.prepare(spec);
-    oscillator.reset();
-
-    // Reset envelope
-    envelope.reset();
+    voicePool.prepare(sampleRate);
+    mixBuffer.assign(static_cast<size_t>(juce::jmax(1, samplesPerBlock)), 0.0f);
 }
 
 void MinimalKickAudioProcessor::releaseResources()
 {
-    // No buffers to release (oscillator and envelope are self-managing)
+    // No buffers to release (voice pool and mix buffer are reused)
+}
+
+void MinimalKickAudioProcessor::renderVoices(juce::AudioBuffer<float>& buffer, int startSample, int numSamples,
+                                             const KickVoicePool::BlockParameters& blockParameters)
+{
+    if (! voicePool.isActive())
+        return;
+
+    const int chunkSize = static_cast<int>(mixBuffer.size());
+
+    // Hosts may exceed the prepared block size; render in chunks of the mix buffer
+    for (int done = 0; done < numSamples; done += chunkSize)
+    {
+        const int count = juce::jmin(chunkSize, numSamples - done);
+        voicePool.render(mixBuffer.data(), count, blockParameters);
+
+        // Write to both channels (mono to stereo)
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            buffer.copyFrom(channel, startSample + done, mixBuffer.data(), count);
+    }
 }
 
 void MinimalKickAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
@@ -101,98 +127,41 @@ void MinimalKickAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     auto* sweepParam = parameters.getRawParameterValue("sweep");
     auto* timeParam = parameters.getRawParameterValue("time");
     auto* driveParam = parameters.getRawParameterValue("drive");
+    auto* bodyParam = parameters.getRawParameterValue("body");
+    auto* transientParam = parameters.getRawParameterValue("transient");
+
+    // Latched by each note-on (pitch sweep table is built from these)
+    KickVoicePool::NoteParameters noteParameters;
+    noteParameters.attackSeconds = attackParam->load() / 1000.0f;  // Convert ms to seconds
+    noteParameters.decaySeconds = decayParam->load() / 1000.0f;
+    noteParameters.sweepSemitones = sweepParam->load();
+    noteParameters.pitchDecaySeconds = timeParam->load() / 1000.0f;
+    noteParameters.shape = juce::roundToInt(bodyParam->load());
+    noteParameters.transientLevel = transientParam->load() / 100.0f;
+
+    KickVoicePool::BlockParameters blockParameters;
+    blockParameters.drive = driveParam->load() / 100.0f;  // 0.0 to 1.0
+
+    // Render up to each note-on, then start its voice (sample-accurate retrigger)
+    const int numSamples = buffer.getNumSamples();
+    int position = 0;
 
-    float attackMs = attackParam->load();
-    float decayMs = decayParam->load();
-    float sweepSemitones = sweepParam->load();
-    float pitchDecayMs = timeParam->load();
-    float drivePercent = driveParam->load();
-
-    // Process MIDI messages
     for (const auto metadata : midiMessages)
     {
-        auto message = metadata.getMessage();
-
-        if (message.isNoteOn())
-        {
-            // Store note and convert to frequency
-            currentNote = message.getNoteNumber();
-            currentFrequency = juce::MidiMessage::getMidiNoteInHertz(currentNote);
-
-            // Reset oscillator phase for consistent attack
-            oscillator.reset();
-
-            // Reset pitch envelope
-            pitchEnvelopeValue = 1.0f;
-            pitchEnvelopeSampleCount = 0;
-
-            // Configure and trigger amplitude envelope
-            juce::ADSR::Parameters envParams;
-            envParams.attack = attackMs / 1000.0f;     // Convert ms to seconds
-            envParams.decay = decayMs / 1000.0f;       // Convert ms to seconds
-            envParams.sustain = 0.0f;                   // Fixed for kick drums
-            envParams.release = 0.0f;                   // Not needed (sustain=0)
-
-            envelope.setParameters(envParams);
-            envelope.noteOn();
-
-            isNoteOn = true;
-        }
-        else if (message.isNoteOff())
-        {
-            // Note-off can be ignored (sustain=0, envelope decays naturally)
-            isNoteOn = false;
-        }
-    }
+        const auto message = metadata.getMessage();
 
-    // Generate audio if envelope is active
-    const int numSamples = buffer.getNumSamples();
+        // Note-off can be ignored (sustain=0, envelope decays naturally)
+        if (! message.isNoteOn())
+            continue;
 
-    if (envelope.isActive())
-    {
-        // Calculate pitch envelope decay rate
-        // Formula: decayRate = -log(0.001) / decayTimeSeconds
-        // This makes the envelope decay to 0.1% of initial value in the specified time
-        float pitchDecaySeconds = pitchDecayMs / 1000.0f;
-        float pitchDecayRate = -std::log(0.001f) / pitchDecaySeconds;
-
-        // Process mono (oscillator generates single channel)
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            // Update pitch envelope (exponential decay)
-            float elapsedSeconds = pitchEnvelopeSampleCount / static_cast<float>(sampleRate);
-            pitchEnvelopeValue = std::exp(-pitchDecayRate * elapsedSeconds);
-            pitchEnvelopeSampleCount++;
-
-            // Calculate modulated frequency
-            // Formula: freq = baseFreq * pow(2.0, envelopeValue * sweepSemitones / 12.0)
-            // This converts semitone offset to frequency multiplier
-            float pitchOffsetSemitones = pitchEnvelopeValue * sweepSemitones;
-            float frequencyMultiplier = std::pow(2.0f, pitchOffsetSemitones / 12.0f);
-            float modulatedFrequency = currentFrequency * frequencyMultiplier;
-
-            // Set oscillator frequency (juce::dsp::Oscillator handles phase continuity)
-            oscillator.setFrequency(modulatedFrequency);
-
-            // Generate sine wave sample
-            float oscillatorSample = oscillator.processSample(0.0f);
-
-            // Apply amplitude envelope
-            float envelopeValue = envelope.getNextSample();
-            float envelopedSample = oscillatorSample * envelopeValue;
-
-            // Apply saturation/drive (tanh waveshaping)
-            float driveNormalized = drivePercent / 100.0f;  // 0.0 to 1.0
-            float gain = 1.0f + (driveNormalized * 9.0f);   // 1.0 to 10.0
-            float outputSample = std::tanh(gain * envelopedSample);
-
-            // Write to both channels (mono to stereo)
-            for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
-            {
-                buffer.setSample(channel, sample, outputSample);
-            }
-        }
+        const int eventPosition = juce::jlimit(position, numSamples, metadata.samplePosition);
+        renderVoices(buffer, position, eventPosition - position, blockParameters);
+        position = eventPosition;
+
+        voicePool.noteOn(message.getNoteNumber(), noteParameters);
     }
+
+    renderVoices(buffer, position, numSamples - position, blockParameters);
 }
 
 juce::AudioProcessorEditor* MinimalKickAudioProcessor::createEditor()
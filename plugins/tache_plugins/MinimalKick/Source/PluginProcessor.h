@@ -1,6 +1,8 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <vector>
+#include "KickVoicePool.h"
 
 class MinimalKickAudioProcessor : public juce::AudioProcessor
 {
@@ -35,18 +37,13 @@ public:
 
 private:
     // DSP Components (declared BEFORE parameters for initialization order)
-    juce::dsp::Oscillator<float> oscillator;
-    juce::ADSR envelope;
-
-    // Voice state
-    bool isNoteOn { false };
-    int currentNote { 60 };  // C4 default
-    float currentFrequency { 0.0f };
+    KickVoicePool voicePool;
+    std::vector<float> mixBuffer;  // Mono mix, sized in prepareToPlay
     double sampleRate { 44100.0 };
 
-    // Pitch envelope state
-    float pitchEnvelopeValue { 0.0f };  // Normalized 0.0 to 1.0 (decays from 1.0 to 0.0)
-    int pitchEnvelopeSampleCount { 0 };
+    // Renders [startSample, startSample + numSamples) of buffer from the voice pool
+    void renderVoices(juce::AudioBuffer<float>& buffer, int startSample, int numSamples,
+                      const KickVoicePool::BlockParameters& blockParameters);
 
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
@@ -0,0 +1,104 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <array>
+#include <cmath>
+
+// Plain biquad coefficients (normalised, a0 = 1). Same designs as
+// juce::dsp::IIR::Coefficients, but a POD value: no allocation, cheap to copy
+// and to keep in tables.
+struct Biquad
+{
+    float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+
+    static Biquad lowPass(double sampleRate, double frequency, double q)
+    {
+        const double n = 1.0 / std::tan(juce::MathConstants<double>::pi * frequency / sampleRate);
+        const double c1 = 1.0 / (1.0 + n / q + n * n);
+        return make(c1, 2.0 * c1, c1, c1 * 2.0 * (1.0 - n * n), c1 * (1.0 - n / q + n * n));
+    }
+
+    static Biquad highPass(double sampleRate, double frequency, double q)
+    {
+        const double n = 1.0 / std::tan(juce::MathConstants<double>::pi * frequency / sampleRate);
+        const double c1 = 1.0 / (1.0 + n / q + n * n);
+        return make(c1 * n * n, -2.0 * c1 * n * n, c1 * n * n, c1 * 2.0 * (1.0 - n * n), c1 * (1.0 - n / q + n * n));
+    }
+
+    static Biquad peak(double sampleRate, double frequency, double q, double gainFactor)
+    {
+        const double A = std::sqrt(juce::jmax(0.0001, gainFactor));
+        const double omega = juce::MathConstants<double>::twoPi * frequency / sampleRate;
+        const double alpha = std::sin(omega) / (2.0 * q);
+        const double c2 = -2.0 * std::cos(omega);
+        const double a0 = 1.0 + alpha / A;
+        return make((1.0 + alpha * A) / a0, c2 / a0, (1.0 - alpha * A) / a0, c2 / a0, (1.0 - alpha / A) / a0);
+    }
+
+private:
+    static Biquad make(double b0, double b1, double b2, double a1, double a2)
+    {
+        return { static_cast<float>(b0), static_cast<float>(b1), static_cast<float>(b2),
+                 static_cast<float>(a1), static_cast<float>(a2) };
+    }
+};
+
+// Hi-hat filter cascade: tone, noise colour, 3 body resonators.
+//
+// Runs stage by stage over a whole block (transposed direct form II), so each
+// stage's coefficients and state stay in registers for the entire loop.
+// Bypassed stages are skipped rather than run as identity filters.
+class HatFilterChain
+{
+public:
+    static constexpr int numStages = 5;
+    enum Stage { tone = 0, noiseColour, resonator1, resonator2, resonator3 };
+
+    void reset()
+    {
+        for (auto& s : state)
+            s = { 0.0f, 0.0f };
+    }
+
+    void setStage(int stage, const Biquad& biquad)
+    {
+        coefficients[static_cast<size_t>(stage)] = biquad;
+        bypassed[static_cast<size_t>(stage)] = false;
+    }
+
+    void bypassStage(int stage)
+    {
+        auto& s = state[static_cast<size_t>(stage)];
+        s = { 0.0f, 0.0f };
+        bypassed[static_cast<size_t>(stage)] = true;
+    }
+
+    // In place
+    void process(float* data, int numSamples)
+    {
+        for (size_t stage = 0; stage < numStages; ++stage)
+        {
+            if (bypassed[stage])
+                continue;
+
+            const auto c = coefficients[stage];
+            float z1 = state[stage][0];
+            float z2 = state[stage][1];
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const float x = data[i];
+                const float y = c.b0 * x + z1;
+                z1 = c.b1 * x - c.a1 * y + z2;
+                z2 = c.b2 * x - c.a2 * y;
+                data[i] = y;
+            }
+
+            state[stage] = { z1, z2 };
+        }
+    }
+
+private:
+    std::array<Biquad, numStages> coefficients {};
+    std::array<std::array<float, 2>, numStages> state {};
+    std::array<bool, numStages> bypassed {};
+};
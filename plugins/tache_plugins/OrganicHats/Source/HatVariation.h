@@ -0,0 +1,119 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cstdint>
+#include "HatFilterChain.h"
+
+// Per-hit variation for the hi-hat voices: velocity layers x round robin.
+//
+// Every hit picks an entry from a small table built in prepare(): its own
+// resonator designs (peaks detuned by up to +-resonatorSpread), a decay/release
+// scale (+-decaySpread) and the noise seed. Entries are derived from the base
+// seed with a hash (the SEED parameter), and the round-robin counters restart
+// in prepare()/reset() and on a seed change, so the same MIDI and seed render
+// bit-identically offline while consecutive hits still differ. No coefficient
+// maths happens per hit.
+class HatVariation
+{
+public:
+    static constexpr int numLayers = 3;      // soft / medium / hard
+    static constexpr int numRoundRobin = 4;
+    static constexpr float resonatorSpread = 0.02f;
+    static constexpr float decaySpread = 0.08f;
+
+    struct Hit
+    {
+        std::array<Biquad, 3> resonators;
+        float decayScale = 1.0f;
+        uint32_t noiseSeed = 1;
+    };
+
+    // Seed 0 is the original table. Once prepared, a new seed rebuilds the table
+    // (72 filter designs, no allocation), so it can be applied at a block start.
+    void setSeed(uint32_t newSeed)
+    {
+        const uint32_t mixed = baseSeed ^ (newSeed * 0x9e3779b9u);
+        if (mixed == seed)
+            return;
+
+        seed = mixed;
+        if (sampleRate > 0.0)
+            build();
+    }
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        build();
+    }
+
+    void reset() { counters = {}; }
+
+    // Audio thread, once per note-on; advances that layer's round robin
+    const Hit& nextHit(bool isClosed, float velocity)
+    {
+        const auto type = isClosed ? 0u : 1u;
+        const auto layer = static_cast<size_t>(juce::jlimit(0, numLayers - 1, static_cast<int>(velocity * numLayers)));
+
+        auto& counter = counters[type][layer];
+        const auto& hit = table[type][layer][counter];
+        counter = (counter + 1) % numRoundRobin;
+        return hit;
+    }
+
+private:
+    void build()
+    {
+        // Fixed peaks at 7kHz, 10kHz, 13kHz (Phase 4.3), -6dB, Q 4
+        const std::array<double, 3> peakFreqs = { 7000.0, 10000.0, 13000.0 };
+        const double gain = juce::Decibels::decibelsToGain(-6.0);
+        const double Q = 4.0;
+
+        for (size_t type = 0; type < 2; ++type)
+        {
+            for (size_t layer = 0; layer < numLayers; ++layer)
+            {
+                for (size_t rr = 0; rr < numRoundRobin; ++rr)
+                {
+                    const auto index = static_cast<uint32_t>((type * numLayers + layer) * numRoundRobin + rr);
+                    auto& hit = table[type][layer][rr];
+
+                    for (size_t i = 0; i < peakFreqs.size(); ++i)
+                    {
+                        const double detune = 1.0 + resonatorSpread * bipolar(index, static_cast<uint32_t>(i));
+                        hit.resonators[i] = Biquad::peak(sampleRate, peakFreqs[i] * detune, Q, gain);
+                    }
+
+                    hit.decayScale = 1.0f + decaySpread * bipolar(index, 3);
+                    hit.noiseSeed = hash(index, 4) | 1u;  // xorshift32 must never be seeded with 0
+                }
+            }
+        }
+
+        reset();
+    }
+
+    // lowbias32 over (seed, entry, field)
+    uint32_t hash(uint32_t entry, uint32_t field) const
+    {
+        uint32_t x = seed ^ (entry * 0x9e3779b9u) ^ (field * 0x85ebca6bu);
+        x ^= x >> 16;
+        x *= 0x7feb352du;
+        x ^= x >> 15;
+        x *= 0x846ca68bu;
+        x ^= x >> 16;
+        return x;
+    }
+
+    // [-1, 1)
+    float bipolar(uint32_t entry, uint32_t field) const
+    {
+        return static_cast<float>(static_cast<int32_t>(hash(entry, field))) * (1.0f / 2147483648.0f);
+    }
+
+    static constexpr uint32_t baseSeed = 0x4f726768u;
+    uint32_t seed = baseSeed;
+    double sampleRate = 0.0;
+    std::array<std::array<std::array<Hit, numRoundRobin>, numLayers>, 2> table {};
+    std::array<std::array<size_t, numLayers>, 2> counters {};
+};
@@ -1,36 +1,28 @@
 #include "HiHatVoice.h"
 
-HiHatVoice::HiHatVoice(juce::AudioProcessorValueTreeState& apvts)
+HiHatVoice::HiHatVoice(juce::AudioProcessorValueTreeState& apvts, HatVariation& variationTable)
     : parameters(apvts)
+    , variation(variationTable)
 {
+    closedTone = parameters.getRawParameterValue("CLOSED_TONE");
+    closedColor = parameters.getRawParameterValue("CLOSED_NOISE_COLOR");
+    closedDecay = parameters.getRawParameterValue("CLOSED_DECAY");
+    openTone = parameters.getRawParameterValue("OPEN_TONE");
+    openColor = parameters.getRawParameterValue("OPEN_NOISE_COLOR");
+    openRelease = parameters.getRawParameterValue("OPEN_RELEASE");
 }
 
 void HiHatVoice::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     currentSampleRate = sampleRate;
+    envelope.setSampleRate(sampleRate);
 
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    spec.numChannels = 1;  // Per-voice mono processing
+    noiseBuffer.assign(static_cast<size_t>(juce::jmax(1, samplesPerBlock)), 0.0f);
+    envelopeBuffer.assign(noiseBuffer.size(), 0.0f);
 
-    toneFilter.prepare(spec);
-    noiseColorFilter.prepare(spec);
-    toneFilter.reset();
-    noiseColorFilter.reset();
-
-    // Initialize resonators (Phase 4.3) - Fixed peaks at 7kHz, 10kHz, 13kHz
-    const std::array<float, 3> peakFreqs = {7000.0f, 10000.0f, 13000.0f};
-    const float Q = 4.0f;  // Moderate resonance for organic body
-    const float gainDB = -6.0f;  // Subtle enhancement
-
-    for (int i = 0; i < 3; ++i)
-    {
-        resonators[i].prepare(spec);
-        *resonators[i].coefficients = *juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-            sampleRate, peakFreqs[i], Q, juce::Decibels::decibelsToGain(gainDB));
-        resonators[i].reset();
-    }
+    // Tone/colour depend on the sample rate too: force a redesign
+    currentTone = currentColor = -1.0f;
+    filters.reset();
 }
 
 bool HiHatVoice::canPlaySound(juce::SynthesiserSound* sound)
@@ -47,17 +39,22 @@ void HiHatVoice::startNote(int midiNoteNumber, float velocity,
     // Store velocity as linear gain (0.0-1.0)
     velocityGain = velocity;
 
+    // Per-hit variation: resonator designs, decay scale and noise seed
+    const auto& hit = variation.nextHit(isClosed, velocity);
+    for (int i = 0; i < 3; ++i)
+        filters.setStage(HatFilterChain::resonator1 + i, hit.resonators[static_cast<size_t>(i)]);
+    noiseState = hit.noiseSeed;
+
     // Configure ADSR based on note type
     if (isClosed)
     {
         // Closed hi-hat: Short decay, no sustain
         // Read CLOSED_DECAY parameter (20-200ms)
-        auto* decayParam = parameters.getRawParameterValue("CLOSED_DECAY");
-        float decayMs = decayParam->load();
+        float decayMs = closedDecay->load();
 
         juce::ADSR::Parameters adsrParams;
         adsrParams.attack = 0.0001f;   // 0.1ms attack
-        adsrParams.decay = decayMs / 1000.0f;  // Convert ms to seconds
+        adsrParams.decay = hit.decayScale * decayMs / 1000.0f;  // Convert ms to seconds
         adsrParams.sustain = 0.0f;     // No sustain
         adsrParams.release = 0.005f;   // 5ms release
 
@@ -67,18 +64,21 @@ void HiHatVoice::startNote(int midiNoteNumber, float velocity,
     {
         // Open hi-hat: No decay, full sustain, long release
         // Read OPEN_RELEASE parameter (100-1000ms)
-        auto* releaseParam = parameters.getRawParameterValue("OPEN_RELEASE");
-        float releaseMs = releaseParam->load();
+        float releaseMs = openRelease->load();
 
         juce::ADSR::Parameters adsrParams;
         adsrParams.attack = 0.0001f;   // 0.1ms attack
         adsrParams.decay = 0.0f;       // No decay
         adsrParams.sustain = 1.0f;     // Full sustain
-        adsrParams.release = releaseMs / 1000.0f;  // Convert ms to seconds
+        adsrParams.release = hit.decayScale * releaseMs / 1000.0f;  // Convert ms to seconds
 
         envelope.setParameters(adsrParams);
     }
 
+    // Velocity moves the tone cutoff, so the designs are per note
+    currentTone = currentColor = -1.0f;
+    filters.reset();
+
     // Trigger envelope
     envelope.noteOn();
 }
@@ -101,97 +101,105 @@ void HiHatVoice::forceRelease()
 {
     // Force envelope to release phase with fast release (<5ms)
     // This is called by choke logic when closed hi-hat cuts open hi-hat
+    auto adsrParams = envelope.getParameters();
+    adsrParams.release = 0.005f;
+    envelope.setParameters(adsrParams);
     envelope.noteOff();
 }
 
-void HiHatVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer,
-                                 int startSample, int numSamples)
+void HiHatVoice::updateFilters(float toneValue, float colorValue)
 {
-    if (!isVoiceActive())
-        return;
+    if (toneValue != currentTone)
+    {
+        currentTone = toneValue;
 
-    // Read parameters once per block (atomic reads)
-    const char* toneParamID = isClosed ? "CLOSED_TONE" : "OPEN_TONE";
-    const char* colorParamID = isClosed ? "CLOSED_NOISE_COLOR" : "OPEN_NOISE_COLOR";
+        // Exponential frequency mapping: 3kHz-15kHz, velocity adds up to +30%
+        float velocityToneMod = velocityGain * 0.3f;
+        float baseFreq = 3000.0f * std::pow(5.0f, toneValue);
+        float finalCutoff = juce::jlimit(20.0f, 20000.0f, baseFreq * (1.0f + velocityToneMod));
 
-    float toneValue = parameters.getRawParameterValue(toneParamID)->load() / 100.0f;  // Normalize to 0.0-1.0
-    float colorValue = parameters.getRawParameterValue(colorParamID)->load() / 100.0f;
+        // LP below 50%, HP above 50%
+        filters.setStage(HatFilterChain::tone, toneValue < 0.5f
+                                                   ? Biquad::lowPass(currentSampleRate, finalCutoff, 0.707)
+                                                   : Biquad::highPass(currentSampleRate, finalCutoff, 0.707));
+    }
 
-    for (int sample = 0; sample < numSamples; ++sample)
+    if (colorValue != currentColor)
     {
-        // 1. Generate white noise: range [-1.0, 1.0]
-        float noiseSample = (noiseGenerator.nextFloat() * 2.0f) - 1.0f;
-
-        // 2. Apply Tone Filter (brightness control)
-        // Exponential frequency mapping: 3kHz-15kHz
-        float velocityToneMod = velocityGain * 0.3f;  // Up to +30% cutoff modulation
-        float baseFreq = 3000.0f * std::pow(5.0f, toneValue);
-        float finalCutoff = baseFreq * (1.0f + velocityToneMod);
-        finalCutoff = juce::jlimit(20.0f, 20000.0f, finalCutoff);
+        currentColor = colorValue;
 
-        // Update Tone Filter coefficients (LP below 50%, HP above 50%)
-        if (toneValue < 0.5f)
+        // Bypass zone at 50% ±2%
+        if (std::abs(colorValue - 0.5f) <= 0.02f)
         {
-            *toneFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                currentSampleRate, finalCutoff, 0.707f);
+            filters.bypassStage(HatFilterChain::noiseColour);
         }
         else
         {
-            *toneFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                currentSampleRate, finalCutoff, 0.707f);
+            // Exponential frequency mapping: 5kHz-10kHz, LP below 50%, HP above 50%
+            float colorFreq = juce::jlimit(20.0f, 20000.0f, 5000.0f * std::pow(2.0f, (colorValue - 0.5f) * 2.0f));
+
+            filters.setStage(HatFilterChain::noiseColour, colorValue < 0.5f
+                                                              ? Biquad::lowPass(currentSampleRate, colorFreq, 0.707)
+                                                              : Biquad::highPass(currentSampleRate, colorFreq, 0.707));
         }
+    }
+}
 
-        // Process through Tone Filter
-        noiseSample = toneFilter.processSample(noiseSample);
+void HiHatVoice::generateNoise(float* data, int numSamples)
+{
+    uint32_t x = noiseState;
 
-        // 3. Apply Noise Color Filter (warmth control)
-        // Bypass zone at 50% ±2%
-        if (std::abs(colorValue - 0.5f) > 0.02f)
-        {
-            // Exponential frequency mapping: 5kHz-10kHz
-            float colorFreq = 5000.0f * std::pow(2.0f, (colorValue - 0.5f) * 2.0f);
-            colorFreq = juce::jlimit(20.0f, 20000.0f, colorFreq);
-
-            // Update Noise Color Filter coefficients (LP below 50%, HP above 50%)
-            if (colorValue < 0.5f)
-            {
-                *noiseColorFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                    currentSampleRate, colorFreq, 0.707f);
-            }
-            else
-            {
-                *noiseColorFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                    currentSampleRate, colorFreq, 0.707f);
-            }
-
-            // Process through Noise Color Filter
-            noiseSample = noiseColorFilter.processSample(noiseSample);
-        }
-        // else: bypass (no filtering at 50%)
+    for (int i = 0; i < numSamples; ++i)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        data[i] = static_cast<float>(static_cast<int32_t>(x)) * (1.0f / 2147483648.0f);
+    }
 
-        // 4. Apply resonators (Phase 4.3) - Fixed peaks for organic body
-        for (auto& resonator : resonators)
-        {
-            noiseSample = resonator.processSample(noiseSample);
-        }
+    noiseState = x;
+}
 
-        // 5. Apply envelope
-        float envelopeSample = envelope.getNextSample();
+void HiHatVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer,
+                                 int startSample, int numSamples)
+{
+    if (!isVoiceActive())
+        return;
+
+    // Read parameters once per block (atomic reads), normalised to 0.0-1.0
+    updateFilters((isClosed ? closedTone : openTone)->load() / 100.0f,
+                  (isClosed ? closedColor : openColor)->load() / 100.0f);
+
+    float* noise = noiseBuffer.data();
+    float* gain = envelopeBuffer.data();
+    const int chunkSize = static_cast<int>(noiseBuffer.size());
+
+    // Hosts may exceed the prepared block size; work in chunks of the scratch size
+    while (numSamples > 0)
+    {
+        const int count = juce::jmin(numSamples, chunkSize);
+
+        // Envelope first, so the rest of the chain only runs up to where the note ends
+        int active = 0;
+        while (active < count && envelope.isActive())
+            gain[active++] = envelope.getNextSample();
 
-        // 6. Apply velocity scaling
-        float outputSample = noiseSample * envelopeSample * velocityGain;
+        generateNoise(noise, active);
+        filters.process(noise, active);
+        juce::FloatVectorOperations::multiply(noise, gain, active);
 
-        // 7. Add to output buffer (don't replace - multiple voices may be active)
+        // Add to output buffer (don't replace - multiple voices may be active)
         for (int channel = 0; channel < outputBuffer.getNumChannels(); ++channel)
-        {
-            outputBuffer.addSample(channel, startSample + sample, outputSample);
-        }
+            outputBuffer.addFrom(channel, startSample, noise, active, velocityGain);
 
         // Stop voice if envelope finished
         if (!envelope.isActive())
         {
             clearCurrentNote();
-            break;
+            return;
         }
+
+        startSample += count;
+        numSamples -= count;
     }
 }
@@ -1,12 +1,16 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
-#include <juce_dsp/juce_dsp.h>
+#include <cstdint>
+#include <vector>
 #include "HiHatSound.h"
+#include "HatFilterChain.h"
+#include "HatVariation.h"
+#include "ChokeGroups.h"
 
 class HiHatVoice : public juce::SynthesiserVoice
 {
 public:
-    HiHatVoice(juce::AudioProcessorValueTreeState& apvts);
+    HiHatVoice(juce::AudioProcessorValueTreeState& apvts, HatVariation& variationTable);
 
     bool canPlaySound(juce::SynthesiserSound* sound) override;
 
@@ -24,20 +28,37 @@ public:
     void prepareToPlay(double sampleRate, int samplesPerBlock);
 
 private:
+    // Recomputes tone/colour coefficients only when the parameters have moved
+    void updateFilters(float toneValue, float colorValue);
+
+    // Fills data with white noise in [-1, 1) (xorshift32)
+    void generateNoise(float* data, int numSamples);
+
     juce::AudioProcessorValueTreeState& parameters;
+    HatVariation& variation;  // Shared by all voices, owned by the processor
+
+    // Cached parameter pointers (no string lookups on the audio thread)
+    std::atomic<float>* closedTone = nullptr;
+    std::atomic<float>* closedColor = nullptr;
+    std::atomic<float>* closedDecay = nullptr;
+    std::atomic<float>* openTone = nullptr;
+    std::atomic<float>* openColor = nullptr;
+    std::atomic<float>* openRelease = nullptr;
 
-    // Noise generation
-    juce::Random noiseGenerator;
+    // Noise generation, reseeded from the variation table on every hit
+    uint32_t noiseState = 1;
 
     // Envelope shaping
     juce::ADSR envelope;
 
-    // Filtering (Phase 4.2)
-    juce::dsp::IIR::Filter<float> toneFilter;
-    juce::dsp::IIR::Filter<float> noiseColorFilter;
+    // Tone -> noise colour -> 3 resonators (Phase 4.2/4.3, per-hit designs)
+    HatFilterChain filters;
+    float currentTone = -1.0f;
+    float currentColor = -1.0f;
 
-    // Resonators (Phase 4.3) - Fixed peaks for organic body
-    std::array<juce::dsp::IIR::Filter<float>, 3> resonators;
+    // Per-block scratch, sized in prepareToPlay
+    std::vector<float> noiseBuffer;
+    std::vector<float> envelopeBuffer;
 
     double currentSampleRate = 44100.0;
 
@@ -46,7 +67,27 @@ private:
     float velocityGain = 1.0f;
 
 public:
-    // Choke support methods (Phase 4.3)
-    bool isOpen() const { return !isClosed; }
+    // Choke support (Phase 4.3): fast release (<5ms) regardless of the note's own release
     void forceRelease();
 };
+
+// Closed hi-hat (member 0) cuts open hi-hat (member 1) at the sample of the closed note-on
+class HiHatSynthesiser : public ChokingSynthesiser<2>
+{
+public:
+    HiHatSynthesiser()
+    {
+        setNoteMember(36, 0);  // C1 = closed
+        setNoteMember(38, 1);  // D1 = open
+
+        getChokeGroups().addToGroup(1, 0, false);
+        getChokeGroups().setChokes(0, 0);
+    }
+
+protected:
+    void chokeVoice(juce::SynthesiserVoice& voice) override
+    {
+        // Every voice in this synthesiser is a HiHatVoice (added by the processor)
+        static_cast<HiHatVoice&>(voice).forceRelease();
+    }
+};
@@ -9,8 +9,8 @@ OrganicHatsAudioProcessor::OrganicHatsAudioProcessor()
     , parameters(*this, nullptr, "PARAMETERS", createParameterLayout())
 {
     // Add 16 voices for polyphony (8 closed + 8 open typical use)
-    for (int i = 0; i < 16; ++i)
-        synth.addVoice(new HiHatVoice(parameters));
+    for (auto& voice : voices)
+        voice = static_cast<HiHatVoice*>(synth.addVoice(new HiHatVoice(parameters, variation)));
 
     // Add hi-hat sound descriptor
     synth.addSound(new HiHatSound());
@@ -70,6 +70,14 @@ juce::AudioProcessorValueTreeState::ParameterLayout OrganicHatsAudioProcessor::c
         "%"
     ));
 
+    // Seed for the per-hit variation table (same seed = identical render)
+    layout.add(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID { "SEED", 1 },
+        "Seed",
+        0, 9999,
+        0  // Default: 0
+    ));
+
     return layout;
 }
 
@@ -82,12 +90,13 @@ void OrganicHatsAudioProcessor::prepareToPlay(double sampleRate, int samplesPerB
     // Prepare synthesiser with sample rate
     synth.setCurrentPlaybackSampleRate(sampleRate);
 
+    // Build the per-hit filter table for the current seed and restart the round robin
+    variation.setSeed(static_cast<uint32_t>(parameters.getRawParameterValue("SEED")->load()));
+    variation.prepare(sampleRate);
+
     // Prepare all voices for DSP processing (Phase 4.2)
-    for (int i = 0; i < synth.getNumVoices(); ++i)
-    {
-        if (auto* voice = dynamic_cast<HiHatVoice*>(synth.getVoice(i)))
-            voice->prepareToPlay(sampleRate, samplesPerBlock);
-    }
+    for (auto* voice : voices)
+        voice->prepareToPlay(sampleRate, samplesPerBlock);
 }
 
 void OrganicHatsAudioProcessor::releaseResources()
@@ -102,32 +111,10 @@ void OrganicHatsAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     // Clear output buffer before synthesiser adds to it
     buffer.clear();
 
-    // Implement choke logic (Phase 4.3): Closed hi-hat cuts open hi-hat
-    for (const auto metadata : midiMessages)
-    {
-        const auto msg = metadata.getMessage();
-        if (msg.isNoteOn())
-        {
-            int noteNumber = msg.getNoteNumber();
-
-            // If closed hi-hat (C1 = 36), choke all active open hi-hats
-            if (noteNumber == 36)
-            {
-                for (int i = 0; i < synth.getNumVoices(); ++i)
-                {
-                    if (auto* voice = dynamic_cast<HiHatVoice*>(synth.getVoice(i)))
-                    {
-                        if (voice->isOpen() && voice->isVoiceActive())
-                        {
-                            voice->forceRelease();
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Render MIDI-triggered hi-hat voices
+    // A new seed rebuilds the variation table (no-op while it is unchanged)
+    variation.setSeed(static_cast<uint32_t>(parameters.getRawParameterValue("SEED")->load()));
+
+    // Render MIDI-triggered hi-hat voices (choke is applied inside the synth's event timeline)
     synth.renderNextBlock(buffer, midiMessages, 0, buffer.getNumSamples());
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
+#include "HiHatVoice.h"
 
 class OrganicHatsAudioProcessor : public juce::AudioProcessor
 {
@@ -34,8 +35,14 @@ public:
 private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
-    // Synthesiser for hi-hat voice management
-    juce::Synthesiser synth;
+    static constexpr int numVoices = 16;
+
+    // Per-hit round-robin/velocity-layer table shared by the voices
+    HatVariation variation;
+
+    // Synthesiser for hi-hat voice management (applies the closed/open choke)
+    HiHatSynthesiser synth;
+    std::array<HiHatVoice*, numVoices> voices {};  // Owned by synth
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OrganicHatsAudioProcessor)
 };
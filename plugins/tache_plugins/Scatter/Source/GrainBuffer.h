@@ -0,0 +1,118 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <cstdint>
+#include <vector>
+
+// Interleaved stereo circular buffer used as the grain source.
+// Each frame stores L and R side by side, so a grain read computes its
+// index and Lagrange3rd weights once and fetches both channels from the
+// same cache line. Size is rounded up to a power of two for mask wrapping.
+//
+// Samples are stored as 16-bit integers with +6dB of headroom (input plus
+// feedback can exceed full scale), halving the memory of a float buffer.
+// The owner sizes it for the capture length actually in use and grows it by
+// copying frames into a larger buffer, so a one-minute capture is only paid for
+// when requested. Frames are addressed by absolute stream position (frames
+// pushed so far); position p lives at p & mask, so two buffers fed the same
+// stream agree on positions regardless of size.
+class StereoGrainBuffer
+{
+public:
+    void setSize(int minimumFrames)
+    {
+        size = juce::nextPowerOfTwo(juce::jmax(4, minimumFrames));
+        mask = size - 1;
+        frames.assign(static_cast<size_t>(size) * 2, 0);
+        writeIndex = 0;
+    }
+
+    void clear()
+    {
+        std::fill(frames.begin(), frames.end(), static_cast<int16_t>(0));
+        writeIndex = 0;
+    }
+
+    int getSize() const { return size; }
+
+    // Copies stream positions [begin, end) from another buffer, newest first (so a
+    // concurrent writer overwriting the oldest frames meets the copy last)
+    void copyFrames(const StereoGrainBuffer& other, int64_t begin, int64_t end)
+    {
+        for (int64_t position = end - 1; position >= begin; --position)
+        {
+            const auto* source = other.frames.data() + (position & other.mask) * 2;
+            auto* destination = frames.data() + (position & mask) * 2;
+            destination[0] = source[0];
+            destination[1] = source[1];
+        }
+    }
+
+    // Silences stream positions [begin, end)
+    void clearFrames(int64_t begin, int64_t end)
+    {
+        for (int64_t position = begin; position < end; ++position)
+        {
+            auto* frame = frames.data() + (position & mask) * 2;
+            frame[0] = frame[1] = 0;
+        }
+    }
+
+    // Next push lands at this stream position
+    void setWritePosition(int64_t position) { writeIndex = static_cast<int>(position & mask); }
+
+    void push(float left, float right)
+    {
+        auto* frame = frames.data() + writeIndex * 2;
+        frame[0] = toStorage(left);
+        frame[1] = toStorage(right);
+        writeIndex = (writeIndex + 1) & mask;
+    }
+
+    // Reads a stereo frame delaySamples behind the newest pushed sample
+    // (delay 0 = newest). Same Lagrange3rd kernel as juce::dsp::DelayLine.
+    void read(float delaySamples, float& left, float& right) const
+    {
+        delaySamples = juce::jlimit(1.0f, static_cast<float>(size - 3), delaySamples);
+
+        const int delayInt = static_cast<int>(delaySamples) - 1;
+        const float delayFrac = delaySamples - static_cast<float>(delayInt);
+
+        // Tap k sits (delayInt + k) samples behind the newest frame
+        const int newest = writeIndex - 1;
+        const auto* f1 = frames.data() + ((newest - delayInt) & mask) * 2;
+        const auto* f2 = frames.data() + ((newest - delayInt - 1) & mask) * 2;
+        const auto* f3 = frames.data() + ((newest - delayInt - 2) & mask) * 2;
+        const auto* f4 = frames.data() + ((newest - delayInt - 3) & mask) * 2;
+
+        const float d1 = delayFrac - 1.0f;
+        const float d2 = delayFrac - 2.0f;
+        const float d3 = delayFrac - 3.0f;
+
+        // Storage scale folded into the interpolation weights
+        const float c1 = -d1 * d2 * d3 / 6.0f * fromStorageScale;
+        const float c2 = d2 * d3 * 0.5f * delayFrac * fromStorageScale;
+        const float c3 = -d1 * d3 * 0.5f * delayFrac * fromStorageScale;
+        const float c4 = d1 * d2 / 6.0f * delayFrac * fromStorageScale;
+
+        left  = static_cast<float>(f1[0]) * c1 + static_cast<float>(f2[0]) * c2
+              + static_cast<float>(f3[0]) * c3 + static_cast<float>(f4[0]) * c4;
+        right = static_cast<float>(f1[1]) * c1 + static_cast<float>(f2[1]) * c2
+              + static_cast<float>(f3[1]) * c3 + static_cast<float>(f4[1]) * c4;
+    }
+
+private:
+    static constexpr float headroom = 2.0f;
+    static constexpr float toStorageScale = 32767.0f / headroom;
+    static constexpr float fromStorageScale = headroom / 32767.0f;
+
+    static int16_t toStorage(float sample)
+    {
+        const float scaled = juce::jlimit(-32767.0f, 32767.0f, sample * toStorageScale);
+        return static_cast<int16_t>(std::lrint(scaled));
+    }
+
+    std::vector<int16_t> frames;  // Interleaved L/R
+    int size = 0;
+    int mask = 0;
+    int writeIndex = 0;
+};
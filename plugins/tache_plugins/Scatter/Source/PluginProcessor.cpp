@@ -58,6 +58,15 @@ juce::AudioProcessorValueTreeState::ParameterLayout ScatterAudioProcessor::creat
         0
     ));
 
+    // pitch_mode - Choice (Scale, MIDI)
+    // MIDI: held notes (relative to root_note) define the pitch set; falls back to scale when none are held
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "pitch_mode", 1 },
+        "Pitch Mode",
+        juce::StringArray { "Scale", "MIDI" },
+        0
+    ));
+
     // pan_random - Float (0.0 to 100.0 %, default: 75.0)
     layout.add(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID { "pan_random", 1 },
@@ -85,6 +94,34 @@ juce::AudioProcessorValueTreeState::ParameterLayout ScatterAudioProcessor::creat
         "%"
     ));
 
+    // capture_length - Float (2.0 to 60.0 s, default: 2.0)
+    // Length of the window grains can address; above 2s this is the long-capture mode
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID { "capture_length", 1 },
+        "Capture Length",
+        juce::NormalisableRange<float>(2.0f, 60.0f, 0.1f, 0.5f),
+        2.0f,
+        "s"
+    ));
+
+    // scan_position - Float (0.0 to 100.0 %, default: 0.0)
+    // Where in the capture new grains start (0% = newest audio, 100% = oldest)
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID { "scan_position", 1 },
+        "Scan Position",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
+        0.0f,
+        "%"
+    ));
+
+    // freeze - Bool (default: false)
+    // Stops writes so grains scan a static capture
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID { "freeze", 1 },
+        "Freeze",
+        false
+    ));
+
     return layout;
 }
 
@@ -96,10 +133,73 @@ ScatterAudioProcessor::ScatterAudioProcessor()
 {
     // Phase 3.2: Initialize scale lookup tables
     initializeScaleTables();
+    rebuildPitchTable(scaleMasks[0], 0);
+
+    // Grows the capture ring when capture_length needs more than it holds
+    startTimerHz(10);
 }
 
 ScatterAudioProcessor::~ScatterAudioProcessor()
 {
+    stopTimer();
+}
+
+int ScatterAudioProcessor::ringFramesFor(double captureSeconds) const
+{
+    // Headroom for the block offset applied to reads and the Lagrange taps
+    return static_cast<int>(std::ceil(currentSampleRate * captureSeconds)) + maxBlockSize + 4;
+}
+
+void ScatterAudioProcessor::timerCallback()
+{
+    // Free the ring the audio thread handed back
+    if (resizeState.load(std::memory_order_acquire) == ResizeState::consumed)
+    {
+        pendingBuffer = StereoGrainBuffer();
+        resizeState.store(ResizeState::idle, std::memory_order_release);
+    }
+
+    if (resizeState.load(std::memory_order_acquire) != ResizeState::idle || maxBlockSize == 0)
+        return;
+
+    const double captureSeconds = parameters.getRawParameterValue("capture_length")->load();
+    const int requiredFrames = ringFramesFor(captureSeconds);
+
+    if (requiredFrames - maxBlockSize - 4 <= captureCapacity.load(std::memory_order_relaxed))
+        return;
+
+    pendingBuffer.setSize(requiredFrames);
+
+    // Bulk history copy, newest first, while the audio thread keeps writing. It overwrites
+    // the oldest frames (up to one block beyond the position it has published), so anything
+    // it may have reached during the copy is silenced rather than kept half-copied.
+    const auto copiedUpTo = framesWritten.load(std::memory_order_acquire);
+    const auto copyFrom = juce::jmax<juce::int64>(0, copiedUpTo - juce::jmin(delayBuffer.getSize(), pendingBuffer.getSize()));
+    pendingBuffer.copyFrames(delayBuffer, copyFrom, copiedUpTo);
+
+    const auto overwrittenBefore = framesWritten.load(std::memory_order_acquire) + maxBlockSize - delayBuffer.getSize();
+    if (overwrittenBefore > copyFrom)
+        pendingBuffer.clearFrames(copyFrom, juce::jmin(overwrittenBefore, copiedUpTo));
+
+    pendingCopiedUpTo = copiedUpTo;
+    resizeState.store(ResizeState::ready, std::memory_order_release);
+}
+
+void ScatterAudioProcessor::takePendingBuffer()
+{
+    if (resizeState.load(std::memory_order_acquire) != ResizeState::ready)
+        return;
+
+    // The old ring ends up in pendingBuffer and is freed by the timer
+    std::swap(delayBuffer, pendingBuffer);
+
+    // The timer copied everything up to pendingCopiedUpTo; only the frames since are left
+    const auto written = framesWritten.load(std::memory_order_relaxed);
+    delayBuffer.copyFrames(pendingBuffer, pendingCopiedUpTo, written);
+    delayBuffer.setWritePosition(written);
+    captureCapacity.store(delayBuffer.getSize() - maxBlockSize - 4, std::memory_order_relaxed);
+
+    resizeState.store(ResizeState::consumed, std::memory_order_release);
 }
 
 void ScatterAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
@@ -112,12 +212,16 @@ void ScatterAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
     spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
 
-    // Prepare delay buffer (size for maximum delay time: 2000ms)
-    auto maxDelayTimeSamples = static_cast<int>(sampleRate * 2.0);  // 2 seconds max
-    currentDelayBufferSize = maxDelayTimeSamples;
-    delayBuffer.setMaximumDelayInSamples(maxDelayTimeSamples);
-    delayBuffer.prepare(spec);
-    delayBuffer.reset();
+    // Prepare capture buffer (sized for the current capture length, 16-bit storage)
+    maxBlockSize = samplesPerBlock;
+    currentDelayBufferSize = static_cast<int>(sampleRate * 2.0);  // Default 2 second window
+
+    pendingBuffer = StereoGrainBuffer();
+    resizeState.store(ResizeState::idle, std::memory_order_release);
+    delayBuffer.setSize(ringFramesFor(parameters.getRawParameterValue("capture_length")->load()));
+    captureCapacity.store(delayBuffer.getSize() - maxBlockSize - 4, std::memory_order_relaxed);
+    framesWritten.store(0, std::memory_order_release);
+    frozenHeadOffset = 0.0f;
 
     // Phase 3.3: Prepare dry/wet mixer
     dryWetMixer.prepare(spec);
@@ -126,6 +230,7 @@ void ScatterAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     // Phase 3.3: Allocate feedback buffer (stereo)
     feedbackBuffer.setSize(2, samplesPerBlock);
     feedbackBuffer.clear();
+    feedbackStage.prepare(sampleRate);
 
     // Initialize grain scheduler
     grainSpawnCounter = 0;
@@ -138,6 +243,7 @@ void ScatterAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
         grain.readPosition = 0.0f;
         grain.windowPosition = 0.0f;
         grain.grainSizeSamples = 0;
+        grain.windowIncrement = 0.0f;
         grain.pan = 0.5f;
         grain.reverse = false;
     }
@@ -150,7 +256,19 @@ void ScatterAudioProcessor::releaseResources()
 void ScatterAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
-    juce::ignoreUnused(midiMessages);
+
+    // Track held MIDI notes for the MIDI pitch mode
+    for (const auto metadata : midiMessages)
+    {
+        const auto message = metadata.getMessage();
+
+        if (message.isNoteOn())
+            heldNotes.set(static_cast<size_t>(message.getNoteNumber()));
+        else if (message.isNoteOff())
+            heldNotes.reset(static_cast<size_t>(message.getNoteNumber()));
+        else if (message.isAllNotesOff() || message.isAllSoundOff())
+            heldNotes.reset();
+    }
 
     // Clear unused output channels
     for (int i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
@@ -163,9 +281,13 @@ void ScatterAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     auto* pitchRandomParam = parameters.getRawParameterValue("pitch_random");
     auto* scaleParam = parameters.getRawParameterValue("scale");
     auto* rootNoteParam = parameters.getRawParameterValue("root_note");
+    auto* pitchModeParam = parameters.getRawParameterValue("pitch_mode");
     auto* panRandomParam = parameters.getRawParameterValue("pan_random");
     auto* feedbackParam = parameters.getRawParameterValue("feedback");
     auto* mixParam = parameters.getRawParameterValue("mix");
+    auto* captureLengthParam = parameters.getRawParameterValue("capture_length");
+    auto* scanPositionParam = parameters.getRawParameterValue("scan_position");
+    auto* freezeParam = parameters.getRawParameterValue("freeze");
 
     float delayTimeMs = delayTimeParam->load();
     float grainSizeMs = grainSizeParam->load();
@@ -173,13 +295,45 @@ void ScatterAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     float pitchRandomPercent = pitchRandomParam->load();
     int scaleIndex = static_cast<int>(scaleParam->load());
     int rootNote = static_cast<int>(rootNoteParam->load());
+    bool midiPitchMode = pitchModeParam->load() > 0.5f;
     float panRandomPercent = panRandomParam->load();
     float feedbackGain = feedbackParam->load() / 100.0f * 0.95f;  // Map 0-100% to 0.0-0.95
     float mixValue = mixParam->load() / 100.0f;  // Map 0-100% to 0.0-1.0
+    float captureLengthSeconds = captureLengthParam->load();
+    float scanPosition = scanPositionParam->load() / 100.0f;  // Map 0-100% to 0.0-1.0
+    const bool wasFrozen = isFrozen;
+    isFrozen = freezeParam->load() > 0.5f;
 
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
 
+    // Take over a grown ring if the message thread prepared one
+    takePendingBuffer();
+
+    // Capture window grains can address (clamped to the current ring until a bigger one arrives)
+    currentDelayBufferSize = juce::jlimit(1, captureCapacity.load(std::memory_order_relaxed),
+                                          static_cast<int>(currentSampleRate * captureLengthSeconds));
+    scanStartSamples = scanPosition * static_cast<float>(currentDelayBufferSize - 1);
+
+    // Frozen: the virtual head runs on by this block. On release the offset is folded into
+    // the grains, which then read relative to the real head again from the same audio.
+    if (isFrozen)
+    {
+        frozenHeadOffset = std::fmod(frozenHeadOffset + static_cast<float>(numSamples),
+                                     static_cast<float>(currentDelayBufferSize));
+    }
+    else if (wasFrozen)
+    {
+        for (auto& grain : grainVoices)
+        {
+            grain.readPosition -= frozenHeadOffset;
+            if (grain.readPosition < 0.0f)
+                grain.readPosition += static_cast<float>(currentDelayBufferSize);
+        }
+
+        frozenHeadOffset = 0.0f;
+    }
+
     // Phase 3.3: Step 1 - Capture dry signal
     juce::dsp::AudioBlock<float> block(buffer);
     dryWetMixer.pushDrySamples(block);
@@ -196,35 +350,37 @@ void ScatterAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         }
     }
 
-    // Phase 3.3: Step 3 - Write input + feedback to delay buffer (stereo)
-    for (int channel = 0; channel < juce::jmin(2, numChannels); ++channel)
+    // Phase 3.3: Step 3 - Write input + feedback to delay buffer (interleaved stereo)
+    // Frozen: skip writes so grains scan the static capture
+    if (!isFrozen)
     {
-        auto* channelData = buffer.getReadPointer(channel);
+        auto* leftData = buffer.getReadPointer(0);
+        auto* rightData = buffer.getReadPointer(numChannels > 1 ? 1 : 0);
 
         for (int sample = 0; sample < numSamples; ++sample)
         {
-            delayBuffer.pushSample(channel, channelData[sample]);
+            delayBuffer.push(leftData[sample], rightData[sample]);
         }
+
+        // Published for the timer's history copy
+        framesWritten.store(framesWritten.load(std::memory_order_relaxed) + numSamples, std::memory_order_release);
     }
 
+    // Phase 3.2: Resolve the active pitch set; the lookup table is only rebuilt when it changes
+    updatePitchSet(midiPitchMode, scaleIndex, rootNote);
+
     // Phase 3.3: Step 4 - Update grain scheduler and spawn grains
-    updateGrainScheduler(densityPercent, grainSizeMs, pitchRandomPercent, panRandomPercent, scaleIndex, rootNote);
+    updateGrainScheduler(densityPercent, grainSizeMs, pitchRandomPercent, panRandomPercent);
 
     // Phase 3.3: Step 5 - Process active grain voices (stereo output)
     processGrainVoices(buffer);
 
-    // Phase 3.3: Step 6 - Apply feedback gain and store for next cycle
-    feedbackBuffer.clear();
-    for (int channel = 0; channel < numChannels; ++channel)
-    {
-        auto* wetData = buffer.getReadPointer(channel);
-        auto* feedbackData = feedbackBuffer.getWritePointer(channel);
+    // Phase 3.3: Step 6 - Condition the wet signal (gain, damping, DC block, limit) and store for next cycle
+    for (int channel = 0; channel < 2; ++channel)
+        feedbackBuffer.copyFrom(channel, 0, buffer, juce::jmin(channel, numChannels - 1), 0, numSamples);
 
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            feedbackData[sample] = wetData[sample] * feedbackGain;
-        }
-    }
+    feedbackStage.process(feedbackBuffer.getWritePointer(0), feedbackBuffer.getWritePointer(1),
+                          numSamples, feedbackGain);
 
     // Phase 3.3: Step 7 - Blend with dry signal using dry/wet mixer
     dryWetMixer.setWetMixProportion(mixValue);
@@ -271,8 +427,11 @@ std::vector<ScatterAudioProcessor::GrainVisualizationData> ScatterAudioProcessor
         {
             GrainVisualizationData vizData;
 
-            // X-axis: Normalized time position in delay buffer (0.0-1.0)
-            vizData.x = grain.readPosition / static_cast<float>(currentDelayBufferSize);
+            // X-axis: Normalized time position in delay buffer (0.0-1.0), from the real head
+            float position = grain.readPosition - frozenHeadOffset;
+            if (position < 0.0f)
+                position += static_cast<float>(currentDelayBufferSize);
+            vizData.x = position / static_cast<float>(currentDelayBufferSize);
 
             // Y-axis: Pitch shift normalized to -1.0 to +1.0 range
             // playbackRate = 2^(semitones / 12)
@@ -308,7 +467,7 @@ void ScatterAudioProcessor::generateHannWindow(int sizeInSamples)
     );
 }
 
-void ScatterAudioProcessor::spawnNewGrain(float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote)
+void ScatterAudioProcessor::spawnNewGrain(float grainSizeMs, float pitchRandomPercent, float panRandomPercent)
 {
     // Convert grain size from ms to samples
     int grainSizeSamples = static_cast<int>(currentSampleRate * grainSizeMs / 1000.0f);
@@ -337,10 +496,10 @@ void ScatterAudioProcessor::spawnNewGrain(float grainSizeMs, float pitchRandomPe
     // Get random number generator
     auto& random = juce::Random::getSystemRandom();
 
-    // Phase 3.2: Generate random pitch and quantize to scale
+    // Phase 3.2: Generate random pitch and quantize to the active pitch set (single table lookup)
     float randomPitch = (random.nextFloat() * 2.0f - 1.0f) * 7.0f * (pitchRandomPercent / 100.0f);
-    int quantizedPitch = quantizePitchToScale(randomPitch, scaleIndex, rootNote);
-    float playbackRate = std::pow(2.0f, quantizedPitch / 12.0f);
+    int pitchIndex = juce::jlimit(0, pitchTableSize - 1, static_cast<int>(std::round(randomPitch)) + 12);
+    float playbackRate = playbackRateTable[static_cast<size_t>(pitchIndex)];
 
     // Phase 3.3: Generate random pan position (0.0 = left, 1.0 = right)
     float basePan = 0.5f;  // Center
@@ -348,6 +507,13 @@ void ScatterAudioProcessor::spawnNewGrain(float grainSizeMs, float pitchRandomPe
     float panAmount = (randomPan - 0.5f) * (panRandomPercent / 100.0f);  // Scaled by parameter
     float pan = juce::jlimit(0.0f, 1.0f, basePan + panAmount);
 
+    // Equal-power crossfade between source channels (same law as AngelGrain)
+    // Pan 0.0 = both channels folded left (0.707 each), 1.0 = folded right.
+    // Pan 0.5 is not the identity: each side gets 0.5 of its own channel plus
+    // ~0.21 crossfeed of the other, so centred grains are slightly narrowed.
+    float leftGain = std::cos(pan * juce::MathConstants<float>::halfPi);
+    float rightGain = std::sin(pan * juce::MathConstants<float>::halfPi);
+
     // Phase 3.3: Random reverse playback (50/50 probability)
     bool reverse = random.nextBool();
 
@@ -355,12 +521,19 @@ void ScatterAudioProcessor::spawnNewGrain(float grainSizeMs, float pitchRandomPe
     availableVoice->active = true;
     availableVoice->grainSizeSamples = grainSizeSamples;
     availableVoice->windowPosition = 0.0f;
+    availableVoice->windowIncrement = 1.0f / static_cast<float>(grainSizeSamples);
     availableVoice->playbackRate = playbackRate;
     availableVoice->pan = pan;
+    availableVoice->leftFromLeft = leftGain * 0.707f;
+    availableVoice->leftFromRight = (1.0f - rightGain) * 0.707f;
+    availableVoice->rightFromRight = rightGain * 0.707f;
+    availableVoice->rightFromLeft = (1.0f - leftGain) * 0.707f;
     availableVoice->reverse = reverse;
 
-    // Read position: Start at current delay buffer write position
-    availableVoice->readPosition = 0.0f;
+    // Read position: Start at the scan position within the capture window
+    availableVoice->readPosition = scanStartSamples + frozenHeadOffset;  // Relative to the virtual head
+    if (availableVoice->readPosition >= static_cast<float>(currentDelayBufferSize))
+        availableVoice->readPosition -= static_cast<float>(currentDelayBufferSize);
 
     // Generate Hann window for this grain size (if not already cached)
     if (windowTableSize != grainSizeSamples)
@@ -369,7 +542,7 @@ void ScatterAudioProcessor::spawnNewGrain(float grainSizeMs, float pitchRandomPe
     }
 }
 
-void ScatterAudioProcessor::updateGrainScheduler(float densityPercent, float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote)
+void ScatterAudioProcessor::updateGrainScheduler(float densityPercent, float grainSizeMs, float pitchRandomPercent, float panRandomPercent)
 {
     // Grain spawn interval calculation: grainSizeSamples / (density * overlapFactor)
     // At 50% density, grains spawn at ~grainSize intervals (moderate overlap)
@@ -392,7 +565,7 @@ void ScatterAudioProcessor::updateGrainScheduler(float densityPercent, float gra
     // Check if it's time to spawn a new grain
     if (grainSpawnCounter >= spawnInterval)
     {
-        spawnNewGrain(grainSizeMs, pitchRandomPercent, panRandomPercent, scaleIndex, rootNote);
+        spawnNewGrain(grainSizeMs, pitchRandomPercent, panRandomPercent);
         grainSpawnCounter = 0;  // Reset counter
     }
 }
@@ -405,6 +578,16 @@ void ScatterAudioProcessor::processGrainVoices(juce::AudioBuffer<float>& buffer)
     // Clear output buffer (grains will be summed into it)
     buffer.clear();
 
+    auto* leftData = buffer.getWritePointer(0);
+    auto* rightData = numChannels >= 2 ? buffer.getWritePointer(1) : nullptr;
+
+    // The whole block is written before grains read it, so each sample is offset by the
+    // samples still ahead of it. While frozen the same offset applies relative to the
+    // virtual head, which is frozenHeadOffset ahead of the stopped one.
+    const int blockOffset = numSamples - 1;
+    const float headOffset = frozenHeadOffset;
+    const float windowSize = static_cast<float>(currentDelayBufferSize);
+
     // Process each active grain voice
     for (auto& grain : grainVoices)
     {
@@ -432,36 +615,31 @@ void ScatterAudioProcessor::processGrainVoices(juce::AudioBuffer<float>& buffer)
                 windowValue = hannWindow[windowIndex];
             }
 
-            // Phase 3.3: Read from delay buffer (stereo, with channel selection)
-            // Use channel 0 for mono-like grain source (could randomize per grain in future)
-            float delaySamples = grain.readPosition;
-            float delayedSample = delayBuffer.popSample(0, delaySamples);
+            // Phase 3.3: Read both channels from the delay buffer in one interleaved read
+            float delaySamples = grain.readPosition + static_cast<float>(juce::jmax(0, blockOffset - sample)) - headOffset;
+            if (delaySamples < 0.0f)
+                delaySamples += windowSize;
+            float sourceL, sourceR;
+            delayBuffer.read(delaySamples, sourceL, sourceR);
 
             // Apply window envelope
-            float grainOutput = delayedSample * windowValue;
-
-            // Phase 3.3: Apply stereo panning
-            float leftGain = 1.0f - grain.pan;   // pan=0.0 → leftGain=1.0, pan=1.0 → leftGain=0.0
-            float rightGain = grain.pan;          // pan=0.0 → rightGain=0.0, pan=1.0 → rightGain=1.0
+            sourceL *= windowValue;
+            sourceR *= windowValue;
 
-            // Sum to output buffer (stereo)
-            if (numChannels >= 2)
+            // Sum to output buffer using the crossfade gains computed at spawn
+            if (rightData != nullptr)
             {
-                auto* leftData = buffer.getWritePointer(0);
-                auto* rightData = buffer.getWritePointer(1);
-
-                leftData[sample] += grainOutput * leftGain;
-                rightData[sample] += grainOutput * rightGain;
+                leftData[sample] += sourceL * grain.leftFromLeft + sourceR * grain.leftFromRight;
+                rightData[sample] += sourceR * grain.rightFromRight + sourceL * grain.rightFromLeft;
             }
-            else if (numChannels == 1)
+            else
             {
                 // Mono output: mix both channels
-                auto* outputData = buffer.getWritePointer(0);
-                outputData[sample] += grainOutput;
+                leftData[sample] += (sourceL + sourceR) * 0.5f;
             }
 
             // Advance grain window position (always at rate 1.0 - envelope progresses normally)
-            grain.windowPosition += 1.0f / grain.grainSizeSamples;
+            grain.windowPosition += grain.windowIncrement;
 
             // Phase 3.3: Advance read position by playback rate (forward or reverse)
             if (grain.reverse)
@@ -494,66 +672,107 @@ void ScatterAudioProcessor::processGrainVoices(juce::AudioBuffer<float>& buffer)
 
 void ScatterAudioProcessor::initializeScaleTables()
 {
+    // 12-bit pitch-class masks (bit n = semitone n above the root)
+
     // Scale 0: Chromatic (all 12 semitones - no quantization)
-    scaleIntervals[0] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    scaleMasks[0] = makePitchMask({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
 
     // Scale 1: Major scale (Ionian mode)
-    scaleIntervals[1] = {0, 2, 4, 5, 7, 9, 11};
+    scaleMasks[1] = makePitchMask({0, 2, 4, 5, 7, 9, 11});
 
     // Scale 2: Natural Minor scale (Aeolian mode)
-    scaleIntervals[2] = {0, 2, 3, 5, 7, 8, 10};
+    scaleMasks[2] = makePitchMask({0, 2, 3, 5, 7, 8, 10});
 
     // Scale 3: Pentatonic scale (Major pentatonic)
-    scaleIntervals[3] = {0, 2, 4, 7, 9};
+    scaleMasks[3] = makePitchMask({0, 2, 4, 7, 9});
 
     // Scale 4: Blues scale
-    scaleIntervals[4] = {0, 3, 5, 6, 7, 10};
+    scaleMasks[4] = makePitchMask({0, 3, 5, 6, 7, 10});
 }
 
-int ScatterAudioProcessor::quantizePitchToScale(float pitchSemitones, int scaleIndex, int rootNote)
+juce::uint16 ScatterAudioProcessor::makePitchMask(std::initializer_list<int> semitones)
 {
-    // Clamp scale index to valid range
-    scaleIndex = juce::jlimit(0, numScales - 1, scaleIndex);
+    juce::uint16 mask = 0;
 
-    // Clamp root note to valid range (0-11 semitones)
-    rootNote = juce::jlimit(0, 11, rootNote);
+    for (int semitone : semitones)
+        mask = static_cast<juce::uint16>(mask | (1 << semitone));
 
-    // Get the selected scale intervals
-    const auto& scale = scaleIntervals[scaleIndex];
+    return mask;
+}
 
-    // Round pitch to nearest semitone
-    int pitchInt = static_cast<int>(std::round(pitchSemitones));
+void ScatterAudioProcessor::updatePitchSet(bool midiPitchMode, int scaleIndex, int rootNote)
+{
+    // Clamp scale index and root note to valid ranges
+    scaleIndex = juce::jlimit(0, numScales - 1, scaleIndex);
+    rootNote = juce::jlimit(0, 11, rootNote);
 
-    // Extract octave and note within octave
-    int octave = pitchInt / 12;
-    int semitone = pitchInt % 12;
+    juce::uint16 mask = scaleMasks[static_cast<size_t>(scaleIndex)];
+    int transpose = rootNote;
 
-    // Handle negative semitones (wrap to positive octave)
-    if (semitone < 0)
+    if (midiPitchMode && heldNotes.any())
     {
-        semitone += 12;
-        octave -= 1;
+        // Held notes as intervals above the root (root_note names the source's key centre)
+        juce::uint16 midiMask = 0;
+
+        for (int note = 0; note < 128; ++note)
+        {
+            if (heldNotes.test(static_cast<size_t>(note)))
+                midiMask = static_cast<juce::uint16>(midiMask | (1 << ((note - rootNote + 120) % 12)));
+        }
+
+        mask = midiMask;
+        transpose = 0;
     }
 
-    // Find nearest scale degree to the semitone
-    int nearestScaleDegree = scale[0];
-    int minDistance = std::abs(semitone - scale[0]);
+    if (mask != currentPitchMask || transpose != currentPitchTranspose)
+        rebuildPitchTable(mask, transpose);
+}
+
+void ScatterAudioProcessor::rebuildPitchTable(juce::uint16 mask, int transpose)
+{
+    currentPitchMask = mask;
+    currentPitchTranspose = transpose;
+
+    // Signed offset from each pitch class to its nearest scale degree, measured around the
+    // octave (min(d, 12 - d)), so a degree just across the octave boundary is found and the
+    // offset carries into the neighbouring octave. Ties go down, as before.
+    std::array<int, 12> nearestOffset {};
 
-    for (int scaleDegree : scale)
+    for (int semitone = 0; semitone < 12; ++semitone)
     {
-        int distance = std::abs(semitone - scaleDegree);
-        if (distance < minDistance)
+        int minDistance = 12;
+
+        for (int degree = 0; degree < 12; ++degree)
         {
-            minDistance = distance;
-            nearestScaleDegree = scaleDegree;
+            if ((mask & (1 << degree)) == 0)
+                continue;
+
+            // Signed distance in -6..5 (a tritone away resolves downwards)
+            int offset = (degree - semitone + 12) % 12;
+            if (offset >= 6)
+                offset -= 12;
+
+            const int distance = std::abs(offset);
+            if (distance < minDistance || (distance == minDistance && offset < nearestOffset[static_cast<size_t>(semitone)]))
+            {
+                minDistance = distance;
+                nearestOffset[static_cast<size_t>(semitone)] = offset;
+            }
         }
     }
 
-    // Reconstruct quantized pitch: octave + scale degree + root transposition
-    int quantizedPitch = (octave * 12) + nearestScaleDegree + rootNote;
+    // Quantized playback rate for every rounded pitch offset (-12..+12 semitones)
+    for (int index = 0; index < pitchTableSize; ++index)
+    {
+        int pitchInt = index - 12;
+        int semitone = (pitchInt + 12) % 12;
 
-    // Clamp to ±12 semitones (prevent extreme playback rates)
-    quantizedPitch = juce::jlimit(-12, 12, quantizedPitch);
+        // Nearest degree (possibly in the octave above or below) + root transposition
+        int quantizedPitch = pitchInt + nearestOffset[static_cast<size_t>(semitone)] + transpose;
 
-    return quantizedPitch;
+        // Clamp to ±12 semitones (prevent extreme playback rates)
+        quantizedPitch = juce::jlimit(-12, 12, quantizedPitch);
+
+        playbackRateTable[static_cast<size_t>(index)] = std::pow(2.0f, static_cast<float>(quantizedPitch) / 12.0f);
+    }
 }
@@ -1,10 +1,15 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "GrainBuffer.h"
+#include "FeedbackStage.h"
 #include <array>
+#include <atomic>
+#include <bitset>
 #include <vector>
 
-class ScatterAudioProcessor : public juce::AudioProcessor
+class ScatterAudioProcessor : public juce::AudioProcessor,
+                              private juce::Timer
 {
 public:
     ScatterAudioProcessor();
@@ -18,7 +23,7 @@ public:
     bool hasEditor() const override { return true; }
 
     const juce::String getName() const override { return "Scatter"; }
-    bool acceptsMidi() const override { return false; }
+    bool acceptsMidi() const override { return true; }
     bool producesMidi() const override { return false; }
     bool isMidiEffect() const override { return false; }
     double getTailLengthSeconds() const override { return 0.0; }
@@ -57,7 +62,14 @@ private:
         float windowPosition = 0.0f;    // Position in window envelope (0.0-1.0)
         int grainSizeSamples = 0;       // Duration of this grain in samples
         float playbackRate = 1.0f;      // Playback speed (pitch shift)
+        float windowIncrement = 0.0f;   // 1 / grainSizeSamples (precomputed at spawn)
         float pan = 0.5f;               // Phase 3.3: Pan position (0.0 = left, 1.0 = right)
+
+        // Stereo crossfade gains (precomputed at spawn from pan)
+        float leftFromLeft = 0.5f;
+        float leftFromRight = 0.0f;
+        float rightFromRight = 0.5f;
+        float rightFromLeft = 0.0f;
         bool reverse = false;           // Phase 3.3: Reverse playback flag
         bool active = false;            // Is this voice currently playing?
     };
@@ -65,8 +77,8 @@ private:
     // DSP components (declare BEFORE parameters for initialization order)
     juce::dsp::ProcessSpec spec;
 
-    // Granular delay buffer (Lagrange3rd interpolation for future pitch shifting)
-    juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> delayBuffer;
+    // Granular delay buffer (interleaved stereo, Lagrange3rd interpolation)
+    StereoGrainBuffer delayBuffer;
 
     // Grain voice pool (64 pre-allocated voices)
     static constexpr int maxGrainVoices = 64;
@@ -82,23 +94,61 @@ private:
 
     // Sample rate tracking
     double currentSampleRate = 44100.0;
-    int currentDelayBufferSize = 0;
+    int currentDelayBufferSize = 0;    // Capture window grains address (from capture_length)
+
+    // Long-capture / freeze state
+    // The ring is sized for capture_length, not for the 60s maximum. When capture_length
+    // grows past it, the message thread allocates a bigger ring and copies the history into
+    // it; the audio thread takes it over at the start of a block (swap, then copies only the
+    // frames written since, no allocation).
+    enum class ResizeState { idle, ready, consumed };
+    StereoGrainBuffer pendingBuffer;   // Message thread in idle/consumed, audio thread in ready
+    std::atomic<ResizeState> resizeState { ResizeState::idle };
+    std::atomic<int> captureCapacity { 0 };  // Frames the current ring can address
+    std::atomic<juce::int64> framesWritten { 0 };  // Stream position of the next push
+    juce::int64 pendingCopiedUpTo = 0;  // pendingBuffer holds the history before this position
+    int maxBlockSize = 0;
+    float scanStartSamples = 0.0f;     // Grain start position within the capture window
+
+    // Freeze stops the write head, not time: grains read relative to a virtual head that
+    // keeps running, so their position and pitch carry on across the toggle.
+    // frozenHeadOffset = how far the virtual head is ahead of the stopped one (mod window).
+    bool isFrozen = false;
+    float frozenHeadOffset = 0.0f;
 
     // Phase 3.2: Scale quantization lookup tables
     static constexpr int numScales = 5;
-    std::array<std::vector<int>, numScales> scaleIntervals;
+    std::array<juce::uint16, numScales> scaleMasks {};  // 12-bit pitch-class masks
+
+    // Active pitch set -> playback rate per rounded pitch offset (-12..+12 semitones)
+    // Rebuilt only when the mask or transposition changes, so spawning is one table index
+    static constexpr int pitchTableSize = 25;
+    std::array<float, pitchTableSize> playbackRateTable {};
+    juce::uint16 currentPitchMask = 0;
+    int currentPitchTranspose = 0;
+
+    // MIDI pitch mode: currently held notes
+    std::bitset<128> heldNotes;
 
     // Phase 3.3: Spatial + Reverse + Feedback components
     juce::dsp::DryWetMixer<float> dryWetMixer;
     juce::AudioBuffer<float> feedbackBuffer;
+    FeedbackStage feedbackStage;  // Damping, DC blocking and soft limiting on the feedback path
+
+    // Long capture: frames needed for capture_length, and ring growth off the audio thread
+    int ringFramesFor(double captureSeconds) const;
+    void takePendingBuffer();
+    void timerCallback() override;
 
     // Helper methods
-    void spawnNewGrain(float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote);
-    void updateGrainScheduler(float densityPercent, float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote);
+    void spawnNewGrain(float grainSizeMs, float pitchRandomPercent, float panRandomPercent);
+    void updateGrainScheduler(float densityPercent, float grainSizeMs, float pitchRandomPercent, float panRandomPercent);
     void processGrainVoices(juce::AudioBuffer<float>& buffer);
     void generateHannWindow(int sizeInSamples);
     void initializeScaleTables();
-    int quantizePitchToScale(float pitchSemitones, int scaleIndex, int rootNote);
+    void updatePitchSet(bool midiPitchMode, int scaleIndex, int rootNote);
+    void rebuildPitchTable(juce::uint16 mask, int transpose);
+    static juce::uint16 makePitchMask(std::initializer_list<int> semitones);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ScatterAudioProcessor)
 };
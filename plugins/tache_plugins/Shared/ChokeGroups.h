@@ -0,0 +1,139 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cstdint>
+
+// Choke groups for drum instruments, by plain member index (pad, slot or
+// sound number). Used by OrganicHats, Drum808 and DrumRoulette.
+//
+// Each member is a bitmask of groups it belongs to (it is cut when one of them
+// is hit) and a bitmask of groups it chokes (hitting it cuts their members).
+//   Mutual group (any pad cuts the others): addToGroup(member, g) for each member
+//   One-way ("closed cuts open"):           addToGroup(open, g, false); setChokes(closed, g)
+// A member that belongs to and chokes the same group also cuts its own previous hits.
+template <int numMembers>
+class ChokeGroups
+{
+public:
+    static constexpr int maxGroups = 32;
+
+    void clear()
+    {
+        memberOf.fill(0);
+        chokesMask.fill(0);
+    }
+
+    void addToGroup(int member, int group, bool chokesGroup = true)
+    {
+        if (! isValid(member, group))
+            return;
+
+        memberOf[static_cast<size_t>(member)] |= bit(group);
+        if (chokesGroup)
+            chokesMask[static_cast<size_t>(member)] |= bit(group);
+    }
+
+    void setChokes(int member, int group)
+    {
+        if (isValid(member, group))
+            chokesMask[static_cast<size_t>(member)] |= bit(group);
+    }
+
+    void removeFromGroups(int member)
+    {
+        if (! juce::isPositiveAndBelow(member, numMembers))
+            return;
+
+        memberOf[static_cast<size_t>(member)] = 0;
+        chokesMask[static_cast<size_t>(member)] = 0;
+    }
+
+    // Does a hit on hitMember cut member?
+    bool chokes(int hitMember, int member) const
+    {
+        if (! juce::isPositiveAndBelow(hitMember, numMembers) || ! juce::isPositiveAndBelow(member, numMembers))
+            return false;
+
+        return (chokesMask[static_cast<size_t>(hitMember)] & memberOf[static_cast<size_t>(member)]) != 0;
+    }
+
+    // callback(member) for every member a hit on hitMember cuts
+    template <typename Callback>
+    void forEachChoked(int hitMember, Callback&& callback) const
+    {
+        for (int member = 0; member < numMembers; ++member)
+            if (chokes(hitMember, member))
+                callback(member);
+    }
+
+private:
+    static uint32_t bit(int group) { return 1u << static_cast<uint32_t>(group); }
+
+    static bool isValid(int member, int group)
+    {
+        return juce::isPositiveAndBelow(member, numMembers) && juce::isPositiveAndBelow(group, maxGroups);
+    }
+
+    std::array<uint32_t, numMembers> memberOf {};
+    std::array<uint32_t, numMembers> chokesMask {};
+};
+
+// juce::Synthesiser that applies choke groups inside its own event timeline.
+//
+// The choke runs in noteOn(), so it lands on the exact sample of the choking
+// note and before that note's voice starts. MIDI notes map to members with
+// setNoteMember(); a voice's member comes from the note it is playing, so no
+// voice type lookups are needed. Subclasses override chokeVoice() to choose
+// how a voice is cut (default: the voice's own tail-off).
+template <int numMembers>
+class ChokingSynthesiser : public juce::Synthesiser
+{
+public:
+    ChokingSynthesiser()
+    {
+        noteMembers.fill(-1);
+
+        // Handle every event at its own sample (the default may move events up to 32 samples early)
+        setMinimumRenderingSubdivisionSize(1, true);
+    }
+
+    void setNoteMember(int midiNoteNumber, int member)
+    {
+        if (juce::isPositiveAndBelow(midiNoteNumber, 128))
+            noteMembers[static_cast<size_t>(midiNoteNumber)] = member;
+    }
+
+    ChokeGroups<numMembers>& getChokeGroups() { return chokeGroups; }
+
+    void noteOn(int midiChannel, int midiNoteNumber, float velocity) override
+    {
+        const int hitMember = memberForNote(midiNoteNumber);
+
+        if (hitMember >= 0)
+        {
+            for (auto* voice : voices)
+            {
+                const int member = memberForNote(voice->getCurrentlyPlayingNote());
+                if (member >= 0 && chokeGroups.chokes(hitMember, member))
+                    chokeVoice(*voice);
+            }
+        }
+
+        juce::Synthesiser::noteOn(midiChannel, midiNoteNumber, velocity);
+    }
+
+protected:
+    virtual void chokeVoice(juce::SynthesiserVoice& voice)
+    {
+        stopVoice(&voice, 1.0f, true);
+    }
+
+private:
+    int memberForNote(int midiNoteNumber) const
+    {
+        return juce::isPositiveAndBelow(midiNoteNumber, 128) ? noteMembers[static_cast<size_t>(midiNoteNumber)] : -1;
+    }
+
+    ChokeGroups<numMembers> chokeGroups;
+    std::array<int, 128> noteMembers {};
+};
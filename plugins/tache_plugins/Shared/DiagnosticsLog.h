@@ -0,0 +1,165 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <cstring>
+
+// Asynchronous diagnostics log shared by every plugin instance in the process.
+//
+// Hold one through juce::SharedResourcePointer<DiagnosticsLog>; all instances
+// share one ring and one writer thread. Callers copy a fixed-size record into a
+// lock-free multi-producer ring (no allocation, no locks, no file I/O), and a
+// background thread drains it to a file. Full ring = record dropped and counted.
+//
+// Off by default. Enable at runtime with setEnabled(true), or for a whole session
+// by setting the TACHE_DIAGNOSTICS environment variable before the host starts.
+// Output: <temp dir>/tache_diagnostics.log (override with TACHE_DIAGNOSTICS_FILE).
+class DiagnosticsLog : private juce::Thread
+{
+public:
+    DiagnosticsLog()
+        : juce::Thread("Tache Diagnostics")
+    {
+        for (size_t i = 0; i < capacity; ++i)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+
+        const auto fileOverride = juce::SystemStats::getEnvironmentVariable("TACHE_DIAGNOSTICS_FILE", {});
+        logFile = fileOverride.isNotEmpty()
+                      ? juce::File(fileOverride)
+                      : juce::File::getSpecialLocation(juce::File::tempDirectory).getChildFile("tache_diagnostics.log");
+
+        if (juce::SystemStats::getEnvironmentVariable("TACHE_DIAGNOSTICS", {}).isNotEmpty())
+            setEnabled(true);
+    }
+
+    ~DiagnosticsLog() override
+    {
+        stopThread(2000);
+        drain();  // Flush anything logged after the last wake-up
+    }
+
+    // Starts the writer thread on first enable; disabling just stops new records
+    void setEnabled(bool shouldBeEnabled)
+    {
+        enabled.store(shouldBeEnabled, std::memory_order_relaxed);
+
+        if (shouldBeEnabled && ! isThreadRunning())
+            startThread(juce::Thread::Priority::background);
+    }
+
+    // Cheap check so callers can skip building the message when disabled
+    bool isEnabled() const noexcept { return enabled.load(std::memory_order_relaxed); }
+
+    // Safe from any thread, including the audio thread (message is truncated, never allocated).
+    // source: short tag such as the plugin name.
+    void log(const char* source, const char* message) noexcept
+    {
+        if (! isEnabled())
+            return;
+
+        size_t position = writePosition.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            auto& slot = slots[position & mask];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+            if (difference == 0)
+            {
+                if (writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.record.timeMs = juce::Time::currentTimeMillis();
+                    copyTruncated(slot.record.source, source);
+                    copyTruncated(slot.record.message, message);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return;
+                }
+            }
+            else if (difference < 0)
+            {
+                droppedRecords.fetch_add(1, std::memory_order_relaxed);  // Ring full
+                return;
+            }
+            else
+            {
+                position = writePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void log(const char* source, const juce::String& message) noexcept
+    {
+        log(source, message.toRawUTF8());
+    }
+
+private:
+    static constexpr size_t capacity = 1024;  // Power of two
+    static constexpr size_t mask = capacity - 1;
+
+    struct Record
+    {
+        juce::int64 timeMs = 0;
+        char source[24] {};
+        char message[232] {};
+    };
+
+    struct Slot
+    {
+        std::atomic<size_t> sequence { 0 };
+        Record record;
+    };
+
+    template <size_t N>
+    static void copyTruncated(char (&destination)[N], const char* text) noexcept
+    {
+        const size_t length = text != nullptr ? juce::jmin(std::strlen(text), N - 1) : 0;
+        if (length > 0)
+            std::memcpy(destination, text, length);
+        destination[length] = '\0';
+    }
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            drain();
+            wait(200);
+        }
+    }
+
+    // Single consumer (writer thread, or the destructor after it has stopped)
+    void drain()
+    {
+        juce::String text;
+
+        for (;;)
+        {
+            auto& slot = slots[readPosition & mask];
+            if (slot.sequence.load(std::memory_order_acquire) != readPosition + 1)
+                break;
+
+            const auto& record = slot.record;
+            text << juce::Time(record.timeMs).toString(true, true, true, true)
+                 << " [" << record.source << "] " << record.message << juce::newLine;
+
+            slot.sequence.store(readPosition + capacity, std::memory_order_release);
+            ++readPosition;
+        }
+
+        if (const auto dropped = droppedRecords.exchange(0, std::memory_order_relaxed); dropped > 0)
+            text << "(" << juce::String(static_cast<juce::int64>(dropped)) << " diagnostics records dropped)" << juce::newLine;
+
+        if (text.isNotEmpty())
+            logFile.appendText(text);
+    }
+
+    std::atomic<bool> enabled { false };
+    std::array<Slot, capacity> slots;
+    std::atomic<size_t> writePosition { 0 };
+    size_t readPosition = 0;
+    std::atomic<size_t> droppedRecords { 0 };
+    juce::File logFile;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DiagnosticsLog)
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include <cmath>
+
+// Rational tanh approximation x(27 + x^2) / (27 + 9x^2), clamped to +-1 beyond
+// |x| = 3 (where the rational form reaches exactly 1). The clamp is written with
+// abs so the function has no calls or branches and vectorises in block loops.
+// Used as the soft limiter/saturator by FeedbackStage, DriveVerb and LushPad.
+inline float fastTanh(float x)
+{
+    x = 0.5f * (std::abs(x + 3.0f) - std::abs(x - 3.0f));
+    const float x2 = x * x;
+    return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+}
@@ -0,0 +1,238 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cmath>
+#include <vector>
+
+// 8-line feedback delay network reverb (100% wet, in place). Used by FlutterVerb and DriveVerb.
+//
+// - Delay lines live in one interleaved ring (one 8-float frame per sample), so
+//   every per-line step is a fixed 8-lane loop that compiles to SIMD (2x SSE/NEON
+//   or 1x AVX register): modulation, damping, mixing and the frame write.
+// - Householder feedback matrix: y = x - (2/N) * sum(x), O(N) and lossless.
+// - Each line has a slow recursive sine LFO on its read position (linear interp)
+//   to break up metallic modes. The phasors are renormalised every
+//   normaliseInterval samples of the running stream, so the output does not
+//   depend on the host block size.
+// - Two-band decay per line: gain g = 10^(-3 * delay / (fs * RT60)) computed
+//   separately for lows and highs, split by a one-pole crossover, so the tail
+//   decays by 60dB in exactly the requested time.
+// - Freeze: input muted, unity gains, integer read positions (no interpolation
+//   loss), so the orthogonal network holds the tail indefinitely.
+// Buffers are sized once in prepare() from the sample rate.
+class FdnReverb
+{
+public:
+    static constexpr int numLines = 8;
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+
+        // Room for the largest SIZE plus modulation depth and interpolation taps
+        const double maxDelaySamples = sampleRate * baseDelaysMs.back() * 0.001 * maxSizeScale;
+        modDepthSamples = static_cast<float>(sampleRate * modDepthMs * 0.001);
+        size = juce::nextPowerOfTwo(static_cast<int>(maxDelaySamples + modDepthSamples) + 4);
+        mask = size - 1;
+        ring.assign(static_cast<size_t>(size) * numLines, 0.0f);
+
+        // Crossover between the low and high decay bands
+        crossoverCoeff = static_cast<float>(1.0 - std::exp(-juce::MathConstants<double>::twoPi * crossoverHz / sampleRate));
+
+        for (int i = 0; i < numLines; ++i)
+        {
+            const double increment = juce::MathConstants<double>::twoPi * modRatesHz[static_cast<size_t>(i)] / sampleRate;
+            modRotSin[i] = static_cast<float>(std::sin(increment));
+            modRotCos[i] = static_cast<float>(std::cos(increment));
+            modSin[i] = std::sin(static_cast<float>(i) * 0.785398f);  // Spread start phases by pi/4
+            modCos[i] = std::cos(static_cast<float>(i) * 0.785398f);
+        }
+
+        currentSize = -1.0f;
+        currentDecay = -1.0f;
+        setParameters(0.5f, 2.5f);
+        std::copy(std::begin(targetDelaySamples), std::end(targetDelaySamples), std::begin(delaySamples));
+        reset();
+    }
+
+    void reset()
+    {
+        std::fill(ring.begin(), ring.end(), 0.0f);
+        writeIndex = 0;
+        dampState.fill(0.0f);
+        samplesUntilNormalise = normaliseInterval;
+    }
+
+    // size: 0-1 (scales all line lengths), decaySeconds: RT60 of the low band.
+    // Highs decay in highDecayRatio * decaySeconds. Recomputes only on change.
+    void setParameters(float size01, float decaySeconds)
+    {
+        if (size01 == currentSize && decaySeconds == currentDecay)
+            return;
+
+        currentSize = size01;
+        currentDecay = decaySeconds;
+
+        const double scale = juce::jmap(static_cast<double>(size01), minSizeScale, maxSizeScale);
+        const double rt60Low = juce::jmax(0.05, static_cast<double>(decaySeconds));
+        const double rt60High = rt60Low * highDecayRatio;
+
+        for (int i = 0; i < numLines; ++i)
+        {
+            const double delay = sampleRate * baseDelaysMs[static_cast<size_t>(i)] * 0.001 * scale;
+            targetDelaySamples[i] = static_cast<float>(delay);
+
+            // Gain per pass through the line so that 60dB is lost after RT60 seconds
+            lowGain[i] = static_cast<float>(std::pow(10.0, -3.0 * delay / (sampleRate * rt60Low)));
+            highGain[i] = static_cast<float>(std::pow(10.0, -3.0 * delay / (sampleRate * rt60High)));
+        }
+    }
+
+    void setFreeze(bool shouldFreeze)
+    {
+        if (shouldFreeze && ! frozen)
+        {
+            // Snap lines to whole samples so the held tail is read without interpolation
+            for (int i = 0; i < numLines; ++i)
+                delaySamples[i] = std::floor(delaySamples[i] + 0.5f);
+        }
+
+        frozen = shouldFreeze;
+    }
+
+    // right may be nullptr (mono: left feeds and receives the network)
+    void process(float* left, float* right, int numSamples)
+    {
+        if (numSamples <= 0)
+            return;
+
+        // Glide line lengths toward SIZE over ~50ms (linear within the block); held while frozen
+        const float glide = frozen ? 0.0f : 1.0f - std::exp(-static_cast<float>(numSamples) / static_cast<float>(sampleRate * 0.05));
+        alignas(32) float delayStep[numLines];
+        for (int i = 0; i < numLines; ++i)
+            delayStep[i] = (targetDelaySamples[i] - delaySamples[i]) * glide / static_cast<float>(numSamples);
+
+        // Frozen: lossless loop, no new input, no modulation
+        const float* feedbackLow = frozen ? unityGain : lowGain;
+        const float* feedbackHigh = frozen ? unityGain : highGain;
+        const float modDepth = frozen ? 0.0f : modDepthSamples;
+        const float injection = frozen ? 0.0f : inputGain;
+
+        alignas(32) float lineOut[numLines];
+        alignas(32) float readPosition[numLines];
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            const float inL = left[n];
+            const float inR = right != nullptr ? right[n] : inL;
+
+            // 1. Modulated read positions (8 lanes)
+            for (int i = 0; i < numLines; ++i)
+            {
+                delaySamples[i] += delayStep[i];
+                readPosition[i] = delaySamples[i] + modSin[i] * modDepth;
+
+                const float s = modSin[i] * modRotCos[i] + modCos[i] * modRotSin[i];
+                modCos[i] = modCos[i] * modRotCos[i] - modSin[i] * modRotSin[i];
+                modSin[i] = s;
+            }
+
+            if (--samplesUntilNormalise == 0)
+            {
+                normaliseModulators();
+                samplesUntilNormalise = normaliseInterval;
+            }
+
+            // 2. Linear-interpolated reads (gather from the interleaved ring)
+            for (int i = 0; i < numLines; ++i)
+            {
+                const int delayInt = static_cast<int>(readPosition[i]);
+                const float frac = readPosition[i] - static_cast<float>(delayInt);
+                const float a = ring[static_cast<size_t>(((writeIndex - delayInt) & mask) * numLines + i)];
+                const float b = ring[static_cast<size_t>(((writeIndex - delayInt - 1) & mask) * numLines + i)];
+                lineOut[i] = a + frac * (b - a);
+            }
+
+            // 3. Two-band decay: g(f) = highGain + (lowGain - highGain) * lowpass
+            float sum = 0.0f;
+            float outL = 0.0f;
+            float outR = 0.0f;
+            for (int i = 0; i < numLines; ++i)
+            {
+                dampState[i] += crossoverCoeff * (lineOut[i] - dampState[i]);
+                lineOut[i] = feedbackHigh[i] * lineOut[i] + (feedbackLow[i] - feedbackHigh[i]) * dampState[i];
+                sum += lineOut[i];
+                outL += lineOut[i] * outputSignsL[static_cast<size_t>(i)];
+                outR += lineOut[i] * outputSignsR[static_cast<size_t>(i)];
+            }
+
+            // 4. Householder mix + input injection, written as one frame
+            const float householder = sum * (2.0f / static_cast<float>(numLines));
+            float* frame = ring.data() + static_cast<size_t>(writeIndex) * numLines;
+            for (int i = 0; i < numLines; ++i)
+            {
+                const float input = (i & 1) != 0 ? inR : inL;
+                frame[i] = lineOut[i] - householder + input * inputSigns[static_cast<size_t>(i)] * injection;
+            }
+
+            writeIndex = (writeIndex + 1) & mask;
+
+            left[n] = outL * outputGain;
+            if (right != nullptr)
+                right[n] = outR * outputGain;
+        }
+    }
+
+private:
+    // Keeps the LFO phasors on the unit circle (first-order correction)
+    void normaliseModulators()
+    {
+        for (int i = 0; i < numLines; ++i)
+        {
+            const float gain = 1.5f - 0.5f * (modSin[i] * modSin[i] + modCos[i] * modCos[i]);
+            modSin[i] *= gain;
+            modCos[i] *= gain;
+        }
+    }
+
+    // Mutually prime-ish line lengths at SIZE = 1.0 (ms)
+    static constexpr std::array<double, numLines> baseDelaysMs { 31.7, 37.1, 41.3, 46.9, 52.3, 59.9, 67.1, 73.7 };
+    static constexpr std::array<double, numLines> modRatesHz { 0.31, 0.43, 0.52, 0.61, 0.73, 0.82, 0.97, 1.09 };
+    static constexpr std::array<float, numLines> inputSigns { 1.0f, 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f, -1.0f };
+    static constexpr std::array<float, numLines> outputSignsL { 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f };
+    static constexpr std::array<float, numLines> outputSignsR { 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f };
+
+    static constexpr double minSizeScale = 0.35;
+    static constexpr double maxSizeScale = 1.25;
+    static constexpr double crossoverHz = 4000.0;
+    static constexpr double highDecayRatio = 0.5;  // Highs die twice as fast (air/wall absorption)
+    static constexpr double modDepthMs = 0.25;
+    static constexpr float inputGain = 0.35f;
+    static constexpr float outputGain = 0.35f;
+    static constexpr int normaliseInterval = 64;
+
+    double sampleRate = 44100.0;
+
+    std::vector<float> ring;  // Interleaved: frame n holds line 0..7
+    int size = 0;
+    int mask = 0;
+    int writeIndex = 0;
+
+    float currentSize = -1.0f;
+    float currentDecay = -1.0f;
+    bool frozen = false;
+    float modDepthSamples = 0.0f;
+    float crossoverCoeff = 0.5f;
+
+    alignas(32) float delaySamples[numLines] {};
+    alignas(32) float targetDelaySamples[numLines] {};
+    alignas(32) float lowGain[numLines] {};
+    alignas(32) float highGain[numLines] {};
+    static constexpr float unityGain[numLines] { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    alignas(32) float modSin[numLines] {};
+    alignas(32) float modCos[numLines] {};
+    alignas(32) float modRotSin[numLines] {};
+    alignas(32) float modRotCos[numLines] {};
+    std::array<float, numLines> dampState {};
+    int samplesUntilNormalise = normaliseInterval;
+};
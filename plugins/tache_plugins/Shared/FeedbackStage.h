@@ -0,0 +1,105 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <cmath>
+#include "FastTanh.h"
+
+// Stereo feedback conditioner for the granular delays (Scatter, AngelGrain).
+// Chain: gain -> damping low-pass -> DC blocker -> soft limiter.
+// Coefficients are computed in prepare()/setDampingFrequency(), never per sample,
+// and the limiter is the shared fastTanh (no transcendental per sample).
+class FeedbackStage
+{
+public:
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+
+        // DC blocker pole for a ~20Hz corner (sample-rate correct)
+        dcCoeff = static_cast<float>(std::exp(-juce::MathConstants<double>::twoPi * 20.0 / sampleRate));
+
+        dampingFrequency = -1.0f;  // Force coefficient update
+        setDampingFrequency(10000.0f);
+        reset();
+    }
+
+    void reset()
+    {
+        for (int channel = 0; channel < 2; ++channel)
+        {
+            lowpassState[channel] = 0.0f;
+            dcInput[channel] = 0.0f;
+            dcOutput[channel] = 0.0f;
+        }
+    }
+
+    // Damping low-pass corner; only recomputes the coefficient when the value changes
+    void setDampingFrequency(float frequencyHz)
+    {
+        if (frequencyHz == dampingFrequency)
+            return;
+
+        dampingFrequency = frequencyHz;
+        const double nyquistSafe = juce::jmin(static_cast<double>(frequencyHz), sampleRate * 0.45);
+        dampingCoeff = static_cast<float>(1.0 - std::exp(-juce::MathConstants<double>::twoPi * nyquistSafe / sampleRate));
+    }
+
+    // Block processing (in place): vector gain, recursive filters per channel,
+    // then a branch-free limiter pass the compiler can vectorise
+    void process(float* left, float* right, int numSamples, float gain)
+    {
+        float* channels[2] = { left, right };
+
+        for (int channel = 0; channel < 2; ++channel)
+        {
+            float* data = channels[channel];
+            juce::FloatVectorOperations::multiply(data, gain, numSamples);
+
+            float lp = lowpassState[channel];
+            float x1 = dcInput[channel];
+            float y1 = dcOutput[channel];
+
+            for (int sample = 0; sample < numSamples; ++sample)
+            {
+                lp += dampingCoeff * (data[sample] - lp);
+                y1 = lp - x1 + dcCoeff * y1;
+                x1 = lp;
+                data[sample] = y1;
+            }
+
+            lowpassState[channel] = lp;
+            dcInput[channel] = x1;
+            dcOutput[channel] = y1;
+
+            for (int sample = 0; sample < numSamples; ++sample)
+                data[sample] = fastTanh(data[sample]);
+        }
+    }
+
+    // Single-frame variant for engines whose feedback loop is sample-accurate
+    void processSample(float& left, float& right, float gain)
+    {
+        left = processChannelSample(0, left * gain);
+        right = processChannelSample(1, right * gain);
+    }
+
+private:
+    float processChannelSample(int channel, float input)
+    {
+        lowpassState[channel] += dampingCoeff * (input - lowpassState[channel]);
+        const float filtered = lowpassState[channel];
+
+        dcOutput[channel] = filtered - dcInput[channel] + dcCoeff * dcOutput[channel];
+        dcInput[channel] = filtered;
+
+        return fastTanh(dcOutput[channel]);
+    }
+
+    double sampleRate = 44100.0;
+    float dampingFrequency = -1.0f;
+    float dampingCoeff = 1.0f;
+    float dcCoeff = 0.995f;
+
+    float lowpassState[2] { 0.0f, 0.0f };
+    float dcInput[2] { 0.0f, 0.0f };
+    float dcOutput[2] { 0.0f, 0.0f };
+};
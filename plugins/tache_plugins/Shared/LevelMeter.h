@@ -0,0 +1,260 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Output/input level meter shared by the effect plugins (TapeAge, FlutterVerb,
+// DriveVerb, AutoClip). Audio thread calls process() once per block; the editor
+// reads a consistent multi-value Snapshot at any time without locking.
+//
+// Per block:
+//   - sample peak (FloatVectorOperations::findMinAndMax) and RMS (4 partial sums,
+//     vectorises without fast-math)
+//   - optional 4x true peak (ITU-R BS.1770 style): 48-tap windowed-sinc polyphase
+//     interpolator, only the 3 fractional phases are evaluated
+//   - VU (300ms integration of power) and PPM (instant attack, 20dB / 1.7s
+//     release) ballistics, integrated in closed form once per block
+// All values are in dB, floored at minimumDb.
+class LevelMeter
+{
+public:
+    static constexpr float minimumDb = -100.0f;
+
+    struct Snapshot
+    {
+        float peakDb = minimumDb;      // Sample peak of the last block (max over channels)
+        float truePeakDb = minimumDb;  // Inter-sample peak of the last block (= peakDb when disabled)
+        float rmsDb = minimumDb;       // RMS of the last block (mean power over channels)
+        float vuDb = minimumDb;        // VU ballistics (RMS, ~300ms)
+        float ppmDb = minimumDb;       // PPM ballistics (peak hold with slow release)
+    };
+
+    void prepare(double newSampleRate, int maximumBlockSize, int numChannels, bool enableTruePeak)
+    {
+        sampleRate = newSampleRate;
+        truePeakEnabled = enableTruePeak;
+        channels = juce::jlimit(1, maxChannels, numChannels);
+
+        if (truePeakEnabled)
+        {
+            chunkSize = juce::jmax(1, maximumBlockSize);
+            for (auto& scratch : truePeakScratch)
+                scratch.assign(static_cast<size_t>(chunkSize + historyLength), 0.0f);
+
+            buildInterpolator();
+        }
+
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& scratch : truePeakScratch)
+            std::fill(scratch.begin(), scratch.end(), 0.0f);
+
+        vuPower = 0.0f;
+        ppmLevel = 0.0f;
+        publish({});
+    }
+
+    // Audio thread. Extra channels beyond the prepared count are ignored.
+    void process(const float* const* channelData, int numChannels, int numSamples)
+    {
+        numChannels = juce::jmin(numChannels, channels);
+        if (numSamples <= 0 || numChannels <= 0)
+            return;
+
+        float peak = 0.0f;
+        float truePeak = 0.0f;
+        float power = 0.0f;
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            const float* data = channelData[channel];
+
+            const auto range = juce::FloatVectorOperations::findMinAndMax(data, numSamples);
+            peak = juce::jmax(peak, -range.getStart(), range.getEnd());
+            power += sumOfSquares(data, numSamples);
+
+            if (truePeakEnabled)
+                truePeak = juce::jmax(truePeak, processTruePeak(channel, data, numSamples));
+        }
+
+        power /= static_cast<float>(numChannels * numSamples);
+        truePeak = juce::jmax(truePeak, peak);
+
+        // VU: one-pole on power, closed form over the whole block
+        const float blockSeconds = static_cast<float>(numSamples / sampleRate);
+        const float vuCoeff = std::exp(-blockSeconds / vuTimeConstant);
+        vuPower = power + vuCoeff * (vuPower - power);
+
+        // PPM: instant attack, constant dB/s release
+        const float releaseGain = juce::Decibels::decibelsToGain(-ppmReleaseDbPerSecond * blockSeconds);
+        ppmLevel = juce::jmax(truePeak, ppmLevel * releaseGain);
+
+        Snapshot snapshot;
+        snapshot.peakDb = toDb(peak);
+        snapshot.truePeakDb = toDb(truePeak);
+        snapshot.rmsDb = toDb(std::sqrt(power));
+        snapshot.vuDb = toDb(std::sqrt(vuPower));
+        snapshot.ppmDb = toDb(ppmLevel);
+        publish(snapshot);
+    }
+
+    void process(const juce::AudioBuffer<float>& buffer)
+    {
+        process(buffer.getArrayOfReadPointers(), buffer.getNumChannels(), buffer.getNumSamples());
+    }
+
+    // Audio thread. For callers that already found the block peak inside a fused
+    // kernel: updates peak/true peak and PPM only (RMS and VU keep their last values).
+    void pushBlockPeak(float peak, int numSamples)
+    {
+        if (numSamples <= 0)
+            return;
+
+        const float blockSeconds = static_cast<float>(numSamples / sampleRate);
+        const float releaseGain = juce::Decibels::decibelsToGain(-ppmReleaseDbPerSecond * blockSeconds);
+        ppmLevel = juce::jmax(peak, ppmLevel * releaseGain);
+
+        Snapshot snapshot = getSnapshot();
+        snapshot.peakDb = toDb(peak);
+        snapshot.truePeakDb = snapshot.peakDb;
+        snapshot.ppmDb = toDb(ppmLevel);
+        publish(snapshot);
+    }
+
+    // Any thread. Seqlock read: retries if the audio thread published mid-read.
+    Snapshot getSnapshot() const
+    {
+        Snapshot snapshot;
+
+        for (;;)
+        {
+            const auto before = sequence.load(std::memory_order_acquire);
+            if ((before & 1u) != 0)
+                continue;
+
+            snapshot.peakDb = values[0].load(std::memory_order_relaxed);
+            snapshot.truePeakDb = values[1].load(std::memory_order_relaxed);
+            snapshot.rmsDb = values[2].load(std::memory_order_relaxed);
+            snapshot.vuDb = values[3].load(std::memory_order_relaxed);
+            snapshot.ppmDb = values[4].load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before)
+                return snapshot;
+        }
+    }
+
+private:
+    static constexpr int maxChannels = 2;
+    static constexpr int tapsPerPhase = 12;
+    static constexpr int historyLength = tapsPerPhase - 1;
+    static constexpr float vuTimeConstant = 0.3f / 4.6f;  // 99% of a step in 300ms
+    static constexpr float ppmReleaseDbPerSecond = 20.0f / 1.7f;
+
+    static float toDb(float gain)
+    {
+        return gain > 0.00001f ? juce::jmax(minimumDb, juce::Decibels::gainToDecibels(gain)) : minimumDb;
+    }
+
+    static float sumOfSquares(const float* data, int numSamples)
+    {
+        float acc[4] { 0.0f, 0.0f, 0.0f, 0.0f };
+        int i = 0;
+
+        for (; i + 4 <= numSamples; i += 4)
+            for (int lane = 0; lane < 4; ++lane)
+                acc[lane] += data[i + lane] * data[i + lane];
+
+        for (; i < numSamples; ++i)
+            acc[0] += data[i] * data[i];
+
+        return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+    }
+
+    // 4x windowed-sinc interpolator, Hann window, centre at tap 24 of 48.
+    // Phase 0 is the input sample itself, so only phases 1-3 are stored.
+    void buildInterpolator()
+    {
+        constexpr int length = 4 * tapsPerPhase;
+
+        for (int phase = 1; phase < 4; ++phase)
+        {
+            for (int k = 0; k < tapsPerPhase; ++k)
+            {
+                const int n = 4 * k + phase;
+                const double x = (n - length / 2) / 4.0;
+                const double sinc = std::sin(juce::MathConstants<double>::pi * x) / (juce::MathConstants<double>::pi * x);
+                const double window = 0.5 - 0.5 * std::cos(juce::MathConstants<double>::twoPi * n / length);
+                interpolator[static_cast<size_t>(phase - 1)][static_cast<size_t>(k)] = static_cast<float>(sinc * window);
+            }
+        }
+    }
+
+    float processTruePeak(int channel, const float* data, int numSamples)
+    {
+        auto& scratch = truePeakScratch[static_cast<size_t>(channel)];
+        float* history = scratch.data();
+        float peak = 0.0f;
+
+        for (int start = 0; start < numSamples; start += chunkSize)
+        {
+            const int count = juce::jmin(chunkSize, numSamples - start);
+
+            // scratch = [previous 11 samples | this chunk]
+            std::copy(data + start, data + start + count, history + historyLength);
+
+            for (int i = 0; i < count; ++i)
+            {
+                const float* taps = history + i;  // taps[historyLength] is the newest sample
+
+                for (const auto& phase : interpolator)
+                {
+                    float sum = 0.0f;
+                    for (int k = 0; k < tapsPerPhase; ++k)
+                        sum += phase[static_cast<size_t>(k)] * taps[historyLength - k];
+                    peak = juce::jmax(peak, std::abs(sum));
+                }
+            }
+
+            std::copy(history + count, history + count + historyLength, history);
+        }
+
+        return peak;
+    }
+
+    // Single writer (audio thread)
+    void publish(const Snapshot& snapshot)
+    {
+        const auto current = sequence.load(std::memory_order_relaxed);
+        sequence.store(current + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        values[0].store(snapshot.peakDb, std::memory_order_relaxed);
+        values[1].store(snapshot.truePeakDb, std::memory_order_relaxed);
+        values[2].store(snapshot.rmsDb, std::memory_order_relaxed);
+        values[3].store(snapshot.vuDb, std::memory_order_relaxed);
+        values[4].store(snapshot.ppmDb, std::memory_order_relaxed);
+
+        sequence.store(current + 2, std::memory_order_release);
+    }
+
+    double sampleRate = 44100.0;
+    int channels = maxChannels;
+    bool truePeakEnabled = false;
+    int chunkSize = 1;
+
+    std::array<std::array<float, tapsPerPhase>, 3> interpolator {};
+    std::array<std::vector<float>, maxChannels> truePeakScratch;
+
+    float vuPower = 0.0f;
+    float ppmLevel = 0.0f;
+
+    std::atomic<uint32_t> sequence { 0 };
+    std::array<std::atomic<float>, 5> values { { { minimumDb }, { minimumDb }, { minimumDb }, { minimumDb }, { minimumDb } } };
+};
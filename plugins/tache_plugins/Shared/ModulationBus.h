@@ -0,0 +1,259 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <cmath>
+
+// Control-rate modulation routing over numLanes lanes (one lane per voice),
+// structure-of-arrays so every step is a plain loop over lanes. Used by LushPad.
+//
+// Setup (message thread, before playback):
+//   addSource()      -> id of a per-lane control signal, one-pole smoothed with a
+//                       time constant in seconds (correct at any sample rate)
+//   addDestination() -> id of a per-lane value with range and scaling
+//   addRoute()       -> source -> destination with a depth
+//
+// Each control step (audio thread, every few dozen samples):
+//   1. Owner writes raw source values into sourceInput(id)[lane]
+//   2. update(numSamples): smooths sources, evaluates destinations
+//        relative: base * (1 + sum(depth * source))
+//        octaves:  base * 2^(sum(depth * source))
+//      clamped to [minimum, maximum], and sets per-sample ramps towards them
+//   3. Audio loop reads value(id)[lane] and adds step(id)[lane] every sample
+// Owners that keep their active lanes packed at the front pass the active count
+// to update() and move lanes with copyLane(), so cost follows the active lanes.
+template <int numLanes>
+class ModulationBus
+{
+public:
+    static constexpr int maxSources = 16;
+    static constexpr int maxDestinations = 16;
+    static constexpr int maxRoutes = 32;
+
+    enum class Scaling { relative, octaves };
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        reset();
+    }
+
+    void reset()
+    {
+        for (int i = 0; i < numSources; ++i)
+            for (int lane = 0; lane < numLanes; ++lane)
+                sources[i].input[lane] = sources[i].smoothed[lane] = 0.0f;
+
+        for (int i = 0; i < numDestinations; ++i)
+        {
+            for (int lane = 0; lane < numLanes; ++lane)
+            {
+                destinations[i].target[lane] = destinations[i].value[lane] = clampToRange(i, destinations[i].base[lane]);
+                destinations[i].step[lane] = 0.0f;
+            }
+        }
+    }
+
+    // Returns -1 when full
+    int addSource(float smoothingSeconds)
+    {
+        if (numSources >= maxSources)
+            return -1;
+
+        sources[numSources].smoothingSeconds = smoothingSeconds;
+        return numSources++;
+    }
+
+    // Returns -1 when full
+    int addDestination(float minimum, float maximum, Scaling scaling = Scaling::relative)
+    {
+        if (numDestinations >= maxDestinations)
+            return -1;
+
+        auto& destination = destinations[numDestinations];
+        destination.minimum = minimum;
+        destination.maximum = maximum;
+        destination.scaling = scaling;
+        return numDestinations++;
+    }
+
+    // Ranges that depend on the sample rate can be set in prepare
+    void setRange(int destination, float minimum, float maximum)
+    {
+        destinations[destination].minimum = minimum;
+        destinations[destination].maximum = maximum;
+    }
+
+    // Returns the route id, or -1 when full or ids are invalid
+    int addRoute(int source, int destination, float depth)
+    {
+        if (numRoutes >= maxRoutes || ! juce::isPositiveAndBelow(source, numSources)
+            || ! juce::isPositiveAndBelow(destination, numDestinations))
+            return -1;
+
+        routes[numRoutes] = { source, destination, depth };
+        return numRoutes++;
+    }
+
+    void setRouteDepth(int route, float depth)
+    {
+        if (juce::isPositiveAndBelow(route, numRoutes))
+            routes[route].depth = depth;
+    }
+
+    // Raw per-lane source values, written by the owner before update()
+    float* sourceInput(int source) { return sources[source].input; }
+    const float* sourceOutput(int source) const { return sources[source].smoothed; }
+
+    void setBase(int destination, float base)
+    {
+        for (int lane = 0; lane < numLanes; ++lane)
+            destinations[destination].base[lane] = base;
+    }
+
+    void setBase(int destination, int lane, float base) { destinations[destination].base[lane] = base; }
+
+    // Value at the end of the current control step (what update() is ramping towards)
+    const float* target(int destination) const { return destinations[destination].target; }
+
+    // Per-sample ramp for the audio loop
+    float* value(int destination) { return destinations[destination].value; }
+    const float* step(int destination) const { return destinations[destination].step; }
+
+    // New note on a lane: smoothed sources restart from their raw input and
+    // destinations jump straight to the resulting value (no ramp from the old note)
+    void resetLane(int lane)
+    {
+        for (int i = 0; i < numSources; ++i)
+            sources[i].smoothed[lane] = sources[i].input[lane];
+
+        for (int i = 0; i < numDestinations; ++i)
+        {
+            auto& destination = destinations[i];
+
+            float amount = 0.0f;
+            for (int r = 0; r < numRoutes; ++r)
+                if (routes[r].destination == i)
+                    amount += routes[r].depth * sources[routes[r].source].smoothed[lane];
+
+            amount = destination.scaling == Scaling::octaves ? std::exp2(amount) : 1.0f + amount;
+            destination.target[lane] = destination.value[lane] = clampToRange(i, destination.base[lane] * amount);
+            destination.step[lane] = 0.0f;
+        }
+    }
+
+    // Moves all per-lane state (sources and destinations) from one lane to another
+    void copyLane(int from, int to)
+    {
+        for (int i = 0; i < numSources; ++i)
+        {
+            sources[i].input[to] = sources[i].input[from];
+            sources[i].smoothed[to] = sources[i].smoothed[from];
+        }
+
+        for (int i = 0; i < numDestinations; ++i)
+        {
+            auto& destination = destinations[i];
+            destination.base[to] = destination.base[from];
+            destination.target[to] = destination.target[from];
+            destination.value[to] = destination.value[from];
+            destination.step[to] = destination.step[from];
+        }
+    }
+
+    // One control step covering numSamples audio samples, for lanes [0, numActiveLanes)
+    void update(int numSamples, int numActiveLanes = numLanes)
+    {
+        if (numSamples <= 0 || numActiveLanes <= 0)
+            return;
+
+        const float inverseN = 1.0f / static_cast<float>(numSamples);
+
+        for (int i = 0; i < numSources; ++i)
+        {
+            auto& source = sources[i];
+            const float coefficient = smoothingCoefficient(source.smoothingSeconds, numSamples);
+
+            for (int lane = 0; lane < numActiveLanes; ++lane)
+                source.smoothed[lane] += (source.input[lane] - source.smoothed[lane]) * coefficient;
+        }
+
+        for (int i = 0; i < numDestinations; ++i)
+        {
+            auto& destination = destinations[i];
+
+            float amount[numLanes] {};
+            for (int r = 0; r < numRoutes; ++r)
+            {
+                if (routes[r].destination != i)
+                    continue;
+
+                const float* smoothed = sources[routes[r].source].smoothed;
+                const float depth = routes[r].depth;
+                for (int lane = 0; lane < numActiveLanes; ++lane)
+                    amount[lane] += depth * smoothed[lane];
+            }
+
+            if (destination.scaling == Scaling::octaves)
+                for (int lane = 0; lane < numActiveLanes; ++lane)
+                    amount[lane] = std::exp2(amount[lane]);
+            else
+                for (int lane = 0; lane < numActiveLanes; ++lane)
+                    amount[lane] = 1.0f + amount[lane];
+
+            for (int lane = 0; lane < numActiveLanes; ++lane)
+            {
+                destination.value[lane] = destination.target[lane];  // Previous ramp has arrived
+                destination.target[lane] = juce::jlimit(destination.minimum, destination.maximum, destination.base[lane] * amount[lane]);
+                destination.step[lane] = (destination.target[lane] - destination.value[lane]) * inverseN;
+            }
+        }
+    }
+
+private:
+    struct Source
+    {
+        float smoothingSeconds = 0.0f;
+        float input[numLanes] {};
+        float smoothed[numLanes] {};
+    };
+
+    struct Destination
+    {
+        float minimum = 0.0f;
+        float maximum = 1.0f;
+        Scaling scaling = Scaling::relative;
+        float base[numLanes] {};
+        float target[numLanes] {};
+        float value[numLanes] {};
+        float step[numLanes] {};
+    };
+
+    struct Route
+    {
+        int source = 0;
+        int destination = 0;
+        float depth = 0.0f;
+    };
+
+    // One-pole over numSamples samples: 1 - e^(-t / tau), 1 when smoothing is off
+    float smoothingCoefficient(float seconds, int numSamples) const
+    {
+        if (seconds <= 0.0f)
+            return 1.0f;
+
+        return 1.0f - std::exp(-static_cast<float>(numSamples / (seconds * sampleRate)));
+    }
+
+    float clampToRange(int destination, float x) const
+    {
+        return juce::jlimit(destinations[destination].minimum, destinations[destination].maximum, x);
+    }
+
+    double sampleRate = 44100.0;
+
+    Source sources[maxSources];
+    Destination destinations[maxDestinations];
+    Route routes[maxRoutes];
+    int numSources = 0;
+    int numDestinations = 0;
+    int numRoutes = 0;
+};
@@ -0,0 +1,224 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <cmath>
+#include <vector>
+
+// Block-based stereo wow/flutter modulator (TapeAge, FlutterVerb).
+//
+// Per chunk of samples:
+//   1. Four recursive sine oscillators (wow/flutter x L/R) fill per-channel
+//      delay-position vectors. No std::sin in the sample loop; rotation
+//      coefficients are only recomputed when a rate changes. Their magnitude
+//      is corrected every normaliseInterval samples of the running stream,
+//      not per chunk, so the output does not depend on the host block size.
+//   2. One interleaved loop writes the input frame to a stereo ring buffer and
+//      reads each channel at its own position with a Lagrange3rd kernel.
+// Buffers are sized once in prepare() from the real sample rate.
+class TapeModulator
+{
+public:
+    struct Settings
+    {
+        float wowHz = 1.0f;
+        float flutterHz = 6.0f;
+        float baseDelaySamples = 0.0f;  // Centre of the modulated delay
+        float wowDepth = 0.0f;          // Fraction of the base delay swept by wow
+        float flutterDepth = 0.0f;      // Fraction of the base delay swept by flutter
+    };
+
+    void prepare(double newSampleRate, int maximumBlockSize, double maxDelaySeconds)
+    {
+        sampleRate = newSampleRate;
+
+        size = juce::nextPowerOfTwo(static_cast<int>(sampleRate * maxDelaySeconds) + 4);
+        mask = size - 1;
+        ring.assign(static_cast<size_t>(size) * 2, 0.0f);
+
+        chunkSize = juce::jmax(1, maximumBlockSize);
+        delayPositions[0].assign(static_cast<size_t>(chunkSize), 0.0f);
+        delayPositions[1].assign(static_cast<size_t>(chunkSize), 0.0f);
+
+        wowRate = -1.0f;
+        flutterRate = -1.0f;
+        reset();
+    }
+
+    void reset()
+    {
+        std::fill(ring.begin(), ring.end(), 0.0f);
+        writeIndex = 0;
+        samplesUntilNormalise = normaliseInterval;
+    }
+
+    // Start phases in radians (e.g. randomised per channel for stereo width)
+    void setPhases(float wowLeft, float wowRight, float flutterLeft, float flutterRight)
+    {
+        wow[0].setPhase(wowLeft);
+        wow[1].setPhase(wowRight);
+        flutter[0].setPhase(flutterLeft);
+        flutter[1].setPhase(flutterRight);
+    }
+
+    // In-place processing. right may be nullptr for mono buffers.
+    void process(float* left, float* right, int numSamples, const Settings& settings)
+    {
+        updateRates(settings.wowHz, settings.flutterHz);
+
+        const float maxDelay = static_cast<float>(size - 4);
+        const float wowScale = settings.baseDelaySamples * settings.wowDepth;
+        const float flutterScale = settings.baseDelaySamples * settings.flutterDepth;
+
+        for (int start = 0; start < numSamples; start += chunkSize)
+        {
+            const int count = juce::jmin(chunkSize, numSamples - start);
+            float* inL = left + start;
+            float* inR = right != nullptr ? right + start : nullptr;
+
+            // 1. Delay-position vectors from the recursive oscillators
+            // (all four advance in lockstep, so they share one normalise countdown)
+            for (int channel = 0; channel < 2; ++channel)
+            {
+                float* positions = delayPositions[channel].data();
+                auto& w = wow[channel];
+                auto& f = flutter[channel];
+                int untilNormalise = samplesUntilNormalise;
+
+                for (int n = 0; n < count;)
+                {
+                    const int end = juce::jmin(count, n + untilNormalise);
+                    untilNormalise -= end - n;
+
+                    for (; n < end; ++n)
+                    {
+                        const float position = settings.baseDelaySamples + w.s * wowScale + f.s * flutterScale;
+                        positions[n] = juce::jlimit(1.0f, maxDelay, position);
+                        w.advance();
+                        f.advance();
+                    }
+
+                    if (untilNormalise == 0)
+                    {
+                        w.normalise();
+                        f.normalise();
+                        untilNormalise = normaliseInterval;
+                    }
+                }
+
+                if (channel == 1)
+                    samplesUntilNormalise = untilNormalise;
+            }
+
+            // 2. Interleaved write + per-channel interpolated read
+            const float* positionsL = delayPositions[0].data();
+            const float* positionsR = delayPositions[1].data();
+
+            for (int n = 0; n < count; ++n)
+            {
+                float* frame = ring.data() + writeIndex * 2;
+                frame[0] = inL[n];
+                frame[1] = inR != nullptr ? inR[n] : inL[n];
+
+                inL[n] = readChannel(0, positionsL[n]);
+                if (inR != nullptr)
+                    inR[n] = readChannel(1, positionsR[n]);
+
+                writeIndex = (writeIndex + 1) & mask;
+            }
+        }
+    }
+
+private:
+    // Recursive (rotating phasor) sine oscillator
+    struct Oscillator
+    {
+        float s = 0.0f, c = 1.0f;    // sin / cos of the current phase
+        float rs = 0.0f, rc = 1.0f;  // sin / cos of the per-sample increment
+
+        void setPhase(float phase)
+        {
+            s = std::sin(phase);
+            c = std::cos(phase);
+        }
+
+        void setIncrement(double radiansPerSample)
+        {
+            rs = static_cast<float>(std::sin(radiansPerSample));
+            rc = static_cast<float>(std::cos(radiansPerSample));
+        }
+
+        void advance()
+        {
+            const float newS = s * rc + c * rs;
+            c = c * rc - s * rs;
+            s = newS;
+        }
+
+        // First-order magnitude correction, every normaliseInterval samples, stops float drift
+        void normalise()
+        {
+            const float gain = 1.5f - 0.5f * (s * s + c * c);
+            s *= gain;
+            c *= gain;
+        }
+    };
+
+    void updateRates(float newWowHz, float newFlutterHz)
+    {
+        if (newWowHz != wowRate)
+        {
+            wowRate = newWowHz;
+            const double increment = juce::MathConstants<double>::twoPi * newWowHz / sampleRate;
+            wow[0].setIncrement(increment);
+            wow[1].setIncrement(increment);
+        }
+
+        if (newFlutterHz != flutterRate)
+        {
+            flutterRate = newFlutterHz;
+            const double increment = juce::MathConstants<double>::twoPi * newFlutterHz / sampleRate;
+            flutter[0].setIncrement(increment);
+            flutter[1].setIncrement(increment);
+        }
+    }
+
+    // Lagrange3rd read (same kernel as juce::dsp::DelayLine); delay 0 = frame just written
+    float readChannel(int channel, float delaySamples) const
+    {
+        const int delayInt = static_cast<int>(delaySamples) - 1;
+        const float delayFrac = delaySamples - static_cast<float>(delayInt);
+
+        const float v1 = ring[static_cast<size_t>(((writeIndex - delayInt) & mask) * 2 + channel)];
+        const float v2 = ring[static_cast<size_t>(((writeIndex - delayInt - 1) & mask) * 2 + channel)];
+        const float v3 = ring[static_cast<size_t>(((writeIndex - delayInt - 2) & mask) * 2 + channel)];
+        const float v4 = ring[static_cast<size_t>(((writeIndex - delayInt - 3) & mask) * 2 + channel)];
+
+        const float d1 = delayFrac - 1.0f;
+        const float d2 = delayFrac - 2.0f;
+        const float d3 = delayFrac - 3.0f;
+
+        const float c1 = -d1 * d2 * d3 / 6.0f;
+        const float c2 = d2 * d3 * 0.5f;
+        const float c3 = -d1 * d3 * 0.5f;
+        const float c4 = d1 * d2 / 6.0f;
+
+        return v1 * c1 + delayFrac * (v2 * c2 + v3 * c3 + v4 * c4);
+    }
+
+    double sampleRate = 44100.0;
+
+    std::vector<float> ring;  // Interleaved L/R
+    int size = 0;
+    int mask = 0;
+    int writeIndex = 0;
+
+    int chunkSize = 1;
+    std::vector<float> delayPositions[2];
+
+    static constexpr int normaliseInterval = 64;
+    int samplesUntilNormalise = normaliseInterval;
+
+    Oscillator wow[2];
+    Oscillator flutter[2];
+    float wowRate = -1.0f;
+    float flutterRate = -1.0f;
+};
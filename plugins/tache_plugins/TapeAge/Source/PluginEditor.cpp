@@ -5,20 +5,22 @@ TapeAgeAudioProcessorEditor::TapeAgeAudioProcessorEditor(TapeAgeAudioProcessor&
     : AudioProcessorEditor(&p)
     , processorRef(p)
 {
-    // Debug logging
-    juce::File debugLog("/tmp/tapeage_debug.log");
-    debugLog.appendText(
-        juce::Time::getCurrentTime().toString(true, true) + " - Editor constructor started\n");
+    // Debug logging (async, off by default)
+    auto& diagnostics = *processorRef.diagnostics;
+    diagnostics.log("TapeAge", "Editor constructor started");
 
     // Log current parameter values BEFORE creating attachments
-    auto* driveParam = processorRef.parameters.getRawParameterValue("drive");
-    auto* ageParam = processorRef.parameters.getRawParameterValue("age");
-    auto* mixParam = processorRef.parameters.getRawParameterValue("mix");
-
-    debugLog.appendText(
-        "  Parameters at editor creation - Drive: " + juce::String(driveParam->load()) +
-        ", Age: " + juce::String(ageParam->load()) +
-        ", Mix: " + juce::String(mixParam->load()) + "\n");
+    if (diagnostics.isEnabled())
+    {
+        auto* driveParam = processorRef.parameters.getRawParameterValue("drive");
+        auto* ageParam = processorRef.parameters.getRawParameterValue("age");
+        auto* mixParam = processorRef.parameters.getRawParameterValue("mix");
+
+        diagnostics.log("TapeAge",
+            "Parameters at editor creation - Drive: " + juce::String(driveParam->load()) +
+            ", Age: " + juce::String(ageParam->load()) +
+            ", Mix: " + juce::String(mixParam->load()));
+    }
 
     // Initialize relays with parameter IDs (MUST match APVTS IDs exactly)
     inputRelay = std::make_unique<juce::WebSliderRelay>("input");
@@ -38,18 +40,14 @@ TapeAgeAudioProcessorEditor::TapeAgeAudioProcessorEditor(TapeAgeAudioProcessor&
             .withOptionsFrom(*ageRelay)
             .withOptionsFrom(*mixRelay)
             .withOptionsFrom(*outputRelay)
-            .withEventListener("jsLog", [](const auto& var) {
-                // Log JavaScript messages to file
+            .withEventListener("jsLog", [this](const auto& var) {
+                // Forward JavaScript messages to the diagnostics log
                 if (var.isString())
-                {
-                    juce::File("/tmp/tapeage_debug.log").appendText(
-                        juce::Time::getCurrentTime().toString(true, true) +
-                        " [JS] " + var.toString() + "\n");
-                }
+                    processorRef.diagnostics->log("TapeAge JS", var.toString());
             })
     );
 
-    debugLog.appendText("  WebView created, about to create attachments\n");
+    diagnostics.log("TapeAge", "WebView created, about to create attachments");
 
     // Initialize attachments (connect parameters to relays)
     // NOTE: These immediately call sendInitialUpdate() which sends current values to WebView
@@ -64,7 +62,7 @@ TapeAgeAudioProcessorEditor::TapeAgeAudioProcessorEditor(TapeAgeAudioProcessor&
     outputAttachment = std::make_unique<juce::WebSliderParameterAttachment>(
         *processorRef.parameters.getParameter("output"), *outputRelay, nullptr);
 
-    debugLog.appendText("  Attachments created (sendInitialUpdate called)\n");
+    diagnostics.log("TapeAge", "Attachments created (sendInitialUpdate called)");
 
     // Add WebView to editor
     addAndMakeVisible(*webView);
@@ -101,7 +99,7 @@ void TapeAgeAudioProcessorEditor::timerCallback()
 {
     // Phase 5.2: Send VU meter updates to JavaScript
     // Read peak level from audio processor (atomic, thread-safe)
-    float dbLevel = processorRef.outputLevel.load(std::memory_order_relaxed);
+    float dbLevel = processorRef.outputMeter.getSnapshot().truePeakDb;
 
     // Emit event to JavaScript (only if WebView is visible)
     webView->emitEventIfBrowserIsVisible("updateVUMeter", dbLevel);
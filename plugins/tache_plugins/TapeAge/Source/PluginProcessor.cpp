@@ -45,6 +45,38 @@ juce::AudioProcessorValueTreeState::ParameterLayout TapeAgeAudioProcessor::creat
         0.0f  // Default: 0dB (unity gain)
     ));
 
+    // saturation - Saturation model (tanh waveshaper or Jiles-Atherton hysteresis)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "saturation", 1 },
+        "Saturation",
+        juce::StringArray { "Tanh", "Hysteresis" },
+        0  // Default: Tanh
+    ));
+
+    // oversampling - Oversampling factor for the saturation stage
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "oversampling", 1 },
+        "Oversampling",
+        juce::StringArray { "2x", "4x", "8x" },
+        0  // Default: 2x
+    ));
+
+    // osFilter - Oversampling filter type (FIR = linear phase, IIR = lower latency and CPU)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "osFilter", 1 },
+        "Oversampling Filter",
+        juce::StringArray { "FIR", "IIR" },
+        0  // Default: FIR
+    ));
+
+    // seed - Random seed for dropouts, hiss and wow/flutter start phases (same seed = identical render)
+    layout.add(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID { "seed", 1 },
+        "Seed",
+        0, 9999,
+        0  // Default: 0
+    ));
+
     return layout;
 }
 
@@ -52,7 +84,6 @@ TapeAgeAudioProcessor::TapeAgeAudioProcessor()
     : AudioProcessor(BusesProperties()
                         .withInput("Input", juce::AudioChannelSet::stereo(), true)
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
-    , oversampler(2, 1, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple)  // 2x oversampling, 1 stage, FIR filters
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
 }
@@ -69,53 +100,56 @@ void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     currentSpec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
     currentSampleRate = sampleRate;
 
-    // Phase 4.1: Prepare oversampling engine
-    oversampler.initProcessing(static_cast<size_t>(samplesPerBlock));
-    oversampler.reset();
+    // Phase 4.1: Prepare oversampling engines
+    saturation.prepare(sampleRate, samplesPerBlock);
 
     // Phase 4.2: Prepare wow/flutter modulation
     // 200ms delay line buffer for pitch modulation (architecture.md line 28)
-    int delaySamples = static_cast<int>(sampleRate * 0.2);
-    delayLine.setMaximumDelayInSamples(delaySamples);
-    delayLine.prepare(currentSpec);
-    delayLine.reset();
-
-    // Initialize random phase offsets per channel for stereo width
-    lfoPhase[0] = random.nextFloat() * juce::MathConstants<float>::twoPi;
-    lfoPhase[1] = random.nextFloat() * juce::MathConstants<float>::twoPi;
-
-    // v1.1.0: Initialize flutter LFO with different random phase
-    flutterPhase[0] = random.nextFloat() * juce::MathConstants<float>::twoPi;
-    flutterPhase[1] = random.nextFloat() * juce::MathConstants<float>::twoPi;
-
-    // Phase 4.3: Prepare degradation features
-    // Initialize dropout state (no dropout at start)
-    dropoutCountdown = static_cast<int>(sampleRate * 0.1);  // 100ms until first check
-    inDropout = false;
-    dropoutSamplesRemaining = 0;
-    dropoutEnvelope = 1.0f;
-
-    // Initialize noise filter state to zero
-    noiseFilterState[0] = 0.0f;
-    noiseFilterState[1] = 0.0f;
-
-    // v1.1.0: Prepare age-dependent high-frequency rolloff filters
-    for (int i = 0; i < 2; ++i)
-    {
-        ageFilter[i].prepare(currentSpec);
-        ageFilter[i].reset();
-        // Initialize with 20kHz lowpass (transparent at age=0)
-        auto coefficients = juce::dsp::IIR::Coefficients<float>::makeFirstOrderLowPass(sampleRate, 20000.0f);
-        ageFilter[i].coefficients = coefficients;
-    }
+    wowFlutter.prepare(sampleRate, samplesPerBlock, 0.2);
+
+    // Initialize random phase offsets per channel for stereo width (derived from the seed)
+    // v1.1.0: Flutter LFO gets its own random phases
+    currentSeed = static_cast<uint32_t>(parameters.getRawParameterValue("seed")->load());
+    TapeRandom phaseRandom(currentSeed ^ 0x9e3779b9u);
+    const float twoPi = juce::MathConstants<float>::twoPi;
+    float wowPhaseL = phaseRandom.nextFloat() * twoPi;
+    float wowPhaseR = phaseRandom.nextFloat() * twoPi;
+    float flutterPhaseL = phaseRandom.nextFloat() * twoPi;
+    float flutterPhaseR = phaseRandom.nextFloat() * twoPi;
+    wowFlutter.setPhases(wowPhaseL, wowPhaseR, flutterPhaseL, flutterPhaseR);
+
+    // Phase 4.3: Prepare degradation features (no dropout at start, streams seeded)
+    degradation.setSeed(currentSeed);
+    degradation.prepare(sampleRate, samplesPerBlock);
+
+    // v1.1.0: Prepare age-dependent high-frequency rolloff filter
+    // Initialize with 20kHz lowpass (transparent at age=0)
+    ageFilterState[0] = 0.0f;
+    ageFilterState[1] = 0.0f;
+    ageFilterCoeff = ageRolloffCoefficient(20000.0f);
+    ageFilterActive = false;
+
+    // Phase 5.2: Output meter with true-peak detection (saturated output has inter-sample peaks)
+    outputMeter.prepare(sampleRate, samplesPerBlock, getTotalNumOutputChannels(), true);
 
     // Phase 4.4: Prepare dry/wet mixer
     dryWetMixer.prepare(currentSpec);
     dryWetMixer.reset();
 
+    // Select oversampler from parameters (also sets hysteresis rate and wet latency)
+    auto* oversamplingParam = parameters.getRawParameterValue("oversampling");
+    auto* osFilterParam = parameters.getRawParameterValue("osFilter");
+    selectOversampler(static_cast<int>(osFilterParam->load()) * TapeSaturation::numOversamplingFactors
+                      + static_cast<int>(oversamplingParam->load()));
+}
+
+void TapeAgeAudioProcessor::selectOversampler(int index)
+{
+    saturation.selectOversampler(index);
+
     // Set wet latency to compensate for oversampler + delay line latency
-    int oversamplerLatency = static_cast<int>(oversampler.getLatencyInSamples());
-    int delayLineLatency = static_cast<int>(sampleRate * 0.1);  // 100ms base delay from wow/flutter
+    int oversamplerLatency = saturation.getLatencyInSamples();
+    int delayLineLatency = static_cast<int>(currentSampleRate * 0.1);  // 100ms base delay from wow/flutter
     int totalWetLatency = oversamplerLatency + delayLineLatency;
     dryWetMixer.setWetLatency(static_cast<float>(totalWetLatency));
 }
@@ -123,10 +157,10 @@ void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
 void TapeAgeAudioProcessor::releaseResources()
 {
     // Phase 4.1: Reset DSP components
-    oversampler.reset();
+    saturation.reset();
 
     // Phase 4.2: Reset wow/flutter modulation
-    delayLine.reset();
+    wowFlutter.reset();
 }
 
 void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
@@ -148,6 +182,17 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         buffer.applyGain(inputGain);
     }
 
+    // Phase 4.1: Switch oversampler if factor/filter changed (before the dry push so latency matches)
+    auto* saturationParam = parameters.getRawParameterValue("saturation");
+    auto* oversamplingParam = parameters.getRawParameterValue("oversampling");
+    auto* osFilterParam = parameters.getRawParameterValue("osFilter");
+    bool useHysteresis = saturationParam->load() > 0.5f;
+    int oversamplerIndex = static_cast<int>(osFilterParam->load()) * TapeSaturation::numOversamplingFactors
+                         + static_cast<int>(oversamplingParam->load());
+
+    if (oversamplerIndex != saturation.getActiveOversampler())
+        selectOversampler(oversamplerIndex);
+
     // Phase 4.4: Store dry signal AFTER input gain
     juce::dsp::AudioBlock<float> block(buffer);
     dryWetMixer.pushDrySamples(block);
@@ -158,57 +203,10 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     dryWetMixer.setWetMixProportion(mixValue);
 
     // Phase 4.1: Core Saturation Processing
-    // Processing chain:
-    // 1. Read drive parameter and calculate gain
-    // 2. Upsample 2x
-    // 3. Apply tanh saturation manually (drive controls gain scaling)
-    // 4. Downsample
-
-    // Read drive parameter (0.0 to 1.0)
+    // Upsample (2x/4x/8x, FIR or IIR), tanh or hysteresis with the progressive
+    // drive curve and makeup gain, downsample (Source/TapeSaturation.h)
     auto* driveParam = parameters.getRawParameterValue("drive");
-    float drive = driveParam->load();
-
-    // Progressive curve mapping (architecture.md):
-    // 0-30%: Very subtle (multiply by 1-2 before tanh)
-    // 30-70%: Moderate warmth (multiply by 2-8)
-    // 70-100%: Heavy saturation (multiply by 8-20)
-    float gain;
-    if (drive <= 0.3f)
-    {
-        // Subtle range: linear interpolation from 1 to 2
-        gain = 1.0f + (drive / 0.3f) * 1.0f;
-    }
-    else if (drive <= 0.7f)
-    {
-        // Moderate range: linear interpolation from 2 to 8
-        gain = 2.0f + ((drive - 0.3f) / 0.4f) * 6.0f;
-    }
-    else
-    {
-        // Heavy range: linear interpolation from 8 to 20
-        gain = 8.0f + ((drive - 0.7f) / 0.3f) * 12.0f;
-    }
-
-    // Upsample
-    auto oversampledBlock = oversampler.processSamplesUp(block);
-
-    // Apply tanh saturation manually in oversampled domain
-    // Calculate makeup gain to compensate for volume increase (v1.1.0)
-    // Simple empirical formula: reduce output level proportionally to gain
-    // This keeps perceived loudness roughly constant
-    float makeupGain = 1.0f / std::sqrt(gain);
-
-    for (size_t channel = 0; channel < oversampledBlock.getNumChannels(); ++channel)
-    {
-        auto* channelData = oversampledBlock.getChannelPointer(channel);
-        for (size_t sample = 0; sample < oversampledBlock.getNumSamples(); ++sample)
-        {
-            channelData[sample] = std::tanh(gain * channelData[sample]) * makeupGain;
-        }
-    }
-
-    // Downsample back to original sample rate
-    oversampler.processSamplesDown(block);
+    saturation.process(block, driveParam->load(), useHysteresis);
 
     // Phase 4.2: Wow/Flutter Modulation
     // Processing chain: Apply pitch modulation via delay line after saturation
@@ -225,197 +223,89 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
 
     // LFO frequency: 0.5-2Hz (architecture.md line 29)
     // Use 1.0Hz as base frequency, scaled by age for subtle variation
-    const float lfoFrequency = 1.0f + age;  // 1.0-2.0Hz range
-    const float lfoPhaseIncrement = (lfoFrequency * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-
-    // v1.1.0: Secondary flutter LFO at 6Hz for texture
-    const float flutterFrequency = 6.0f;
-    const float flutterPhaseIncrement = (flutterFrequency * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-    const float flutterDepthRatio = 0.2f;  // 20% of wow depth
-
-    // Process each channel
+    // v1.1.0: Secondary flutter LFO at 6Hz for texture, 20% of wow depth
+    TapeModulator::Settings modulation;
+    modulation.wowHz = 1.0f + age;  // 1.0-2.0Hz range
+    modulation.flutterHz = 6.0f;
+    modulation.baseDelaySamples = static_cast<float>(currentSampleRate) * 0.1f;  // 100ms center
+    modulation.wowDepth = modulationDepth;
+    modulation.flutterDepth = modulationDepth * 0.2f;
+
+    // Both channels in one pass (LFO curves and read positions computed per block)
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
 
-    for (int channel = 0; channel < numChannels; ++channel)
-    {
-        auto* channelData = buffer.getWritePointer(channel);
-
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            // Calculate primary wow LFO (sine wave)
-            float lfoValue = std::sin(lfoPhase[channel]);
-
-            // v1.1.0: Calculate secondary flutter LFO and combine
-            float flutterValue = std::sin(flutterPhase[channel]);
-            float combinedModulation = lfoValue + (flutterValue * flutterDepthRatio);
-
-            // Calculate delay time in samples
-            // Base delay at center of buffer (100ms) + combined modulation
-            float baseDelaySamples = static_cast<float>(currentSampleRate) * 0.1f;  // 100ms center
-            float modulationSamples = combinedModulation * modulationDepth * baseDelaySamples;
-            float totalDelay = baseDelaySamples + modulationSamples;
-
-            // Push input sample to delay line
-            delayLine.pushSample(channel, channelData[sample]);
-
-            // Read modulated sample from delay line
-            channelData[sample] = delayLine.popSample(channel, totalDelay);
-
-            // Advance LFO phases
-            lfoPhase[channel] += lfoPhaseIncrement;
-            if (lfoPhase[channel] >= juce::MathConstants<float>::twoPi)
-                lfoPhase[channel] -= juce::MathConstants<float>::twoPi;
-
-            flutterPhase[channel] += flutterPhaseIncrement;
-            if (flutterPhase[channel] >= juce::MathConstants<float>::twoPi)
-                flutterPhase[channel] -= juce::MathConstants<float>::twoPi;
-        }
-    }
+    wowFlutter.process(buffer.getWritePointer(0),
+                       numChannels > 1 ? buffer.getWritePointer(1) : nullptr,
+                       numSamples, modulation);
 
     // v1.1.0: Age-dependent high-frequency rolloff (simulates tape aging)
     // Age 0%: 20kHz (transparent), Age 100%: 8kHz (vintage tape character)
-    if (age > 0.01f)  // Only apply filter if age is significant
-    {
-        // Exponential mapping for musical response: 20kHz -> 8kHz
-        float cutoffFrequency = 20000.0f * std::pow(0.4f, age);  // 0.4^1 = 0.4, so 20kHz * 0.4 = 8kHz at age=1
-
-        // Update filter coefficients if cutoff changed significantly
-        auto coefficients = juce::dsp::IIR::Coefficients<float>::makeFirstOrderLowPass(currentSampleRate, cutoffFrequency);
-
-        for (int channel = 0; channel < numChannels; ++channel)
-        {
-            ageFilter[channel].coefficients = coefficients;
-            auto* channelData = buffer.getWritePointer(channel);
+    // Exponential mapping for musical response: 0.4^1 = 0.4, so 20kHz * 0.4 = 8kHz at age=1
+    float cutoffFrequency = age > 0.01f ? 20000.0f * std::pow(0.4f, age) : 20000.0f;
+    float targetCoeff = ageRolloffCoefficient(cutoffFrequency);
 
-            for (int sample = 0; sample < numSamples; ++sample)
-            {
-                channelData[sample] = ageFilter[channel].processSample(channelData[sample]);
-            }
-        }
-    }
-
-    // Phase 4.3: Degradation Features (Dropout + Noise)
-    // Processing chain: Apply dropout and tape noise after wow/flutter modulation
-
-    // === Dropout Generator ===
-    // Check every 100ms if dropout should occur (architecture.md line 116)
-    dropoutCountdown -= numSamples;
-    if (dropoutCountdown <= 0)
+    // Only filter if age is significant, or while ramping back to the transparent setting
+    // (an empty block has no first sample to seed from and no length to ramp over)
+    if (numSamples > 0 && (age > 0.01f || targetCoeff != ageFilterCoeff))
     {
-        dropoutCountdown = static_cast<int>(currentSampleRate * 0.1);  // Reset to 100ms
-
-        // Probability scaled by age (architecture.md line 38: rare events every 5-10 seconds at max age)
-        // At age=1.0, probability = 0.02 (2% per 100ms check = ~20% per second = 5-10 second intervals)
-        float dropoutProbability = age * 0.02f;
+        auto* leftData = buffer.getWritePointer(0);
+        auto* rightData = numChannels > 1 ? buffer.getWritePointer(1) : nullptr;
 
-        if (random.nextFloat() < dropoutProbability && !inDropout)
+        // Entering from bypass: start at steady state so the filter doesn't click in
+        if (!ageFilterActive)
         {
-            // Start dropout event
-            inDropout = true;
-            // Random duration: 50-150ms (architecture.md line 39)
-            float dropoutDurationMs = 50.0f + random.nextFloat() * 100.0f;
-            dropoutSamplesRemaining = static_cast<int>(currentSampleRate * dropoutDurationMs / 1000.0f);
+            ageFilterState[0] = leftData[0];
+            ageFilterState[1] = rightData != nullptr ? rightData[0] : leftData[0];
+            ageFilterActive = true;
         }
-    }
 
-    // Process dropout envelope (smooth attack/release to avoid clicks)
-    if (inDropout && dropoutSamplesRemaining > 0)
-    {
-        // Random attenuation factor 0.1-0.3 (70-90% reduction) (architecture.md line 40)
-        const float dropoutTargetGain = 0.1f + random.nextFloat() * 0.2f;
-
-        // Envelope attack/release time: 5-10ms (architecture.md line 118)
-        const float envelopeTimeMs = 7.5f;  // Mid-range
-        const float envelopeTimeSamples = currentSampleRate * envelopeTimeMs / 1000.0f;
-        const float envelopeIncrement = 1.0f / envelopeTimeSamples;
+        // Linear coefficient ramp across the block (smooth age automation)
+        float coeff = ageFilterCoeff;
+        const float coeffStep = (targetCoeff - ageFilterCoeff) / static_cast<float>(numSamples);
+        float stateL = ageFilterState[0];
+        float stateR = ageFilterState[1];
 
-        for (int sample = 0; sample < numSamples && dropoutSamplesRemaining > 0; ++sample)
+        for (int sample = 0; sample < numSamples; ++sample)
         {
-            // Attack: Fade down to dropout gain
-            if (dropoutEnvelope > dropoutTargetGain)
-            {
-                dropoutEnvelope -= envelopeIncrement;
-                if (dropoutEnvelope < dropoutTargetGain)
-                    dropoutEnvelope = dropoutTargetGain;
-            }
+            coeff += coeffStep;
+
+            // TPT one-pole lowpass: v = g * (x - s), y = v + s, s = y + v
+            float v = coeff * (leftData[sample] - stateL);
+            leftData[sample] = v + stateL;
+            stateL = leftData[sample] + v;
 
-            // Apply dropout attenuation to all channels (stereo coherence)
-            for (int channel = 0; channel < numChannels; ++channel)
+            if (rightData != nullptr)
             {
-                auto* channelData = buffer.getWritePointer(channel);
-                channelData[sample] *= dropoutEnvelope;
+                v = coeff * (rightData[sample] - stateR);
+                rightData[sample] = v + stateR;
+                stateR = rightData[sample] + v;
             }
-
-            dropoutSamplesRemaining--;
         }
 
-        if (dropoutSamplesRemaining <= 0)
-        {
-            // End dropout, start release
-            inDropout = false;
-        }
+        ageFilterState[0] = stateL;
+        ageFilterState[1] = stateR;
+        ageFilterCoeff = targetCoeff;
     }
-    else if (dropoutEnvelope < 1.0f)
+    else
     {
-        // Release: Fade back to full gain
-        const float envelopeTimeMs = 7.5f;
-        const float envelopeTimeSamples = currentSampleRate * envelopeTimeMs / 1000.0f;
-        const float envelopeIncrement = 1.0f / envelopeTimeSamples;
-
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            dropoutEnvelope += envelopeIncrement;
-            if (dropoutEnvelope >= 1.0f)
-            {
-                dropoutEnvelope = 1.0f;
-                break;
-            }
-
-            // Apply release envelope to all channels
-            for (int channel = 0; channel < numChannels; ++channel)
-            {
-                auto* channelData = buffer.getWritePointer(channel);
-                channelData[sample] *= dropoutEnvelope;
-            }
-        }
+        ageFilterActive = false;
     }
 
-    // === Tape Noise Generator ===
-    // Filtered white noise at subtle amplitude (architecture.md line 124-129)
-    // v1.1.0: Increased noise floor for more present vintage character
-    // Noise amplitude scaled by age: 0% = silent, 100% = -60dB
-
-    // Calculate noise gain based on age
-    // age = 0.0 → noiseGain = 0.0 (silent)
-    // age = 1.0 → noiseGain = 0.001 (-60dB, was -80dB)
-    float noiseGain = age * 0.001f;  // Maximum -60dB at full age (subtle but more present)
-
-    if (noiseGain > 0.0f)
+    // Phase 4.3: Degradation Features (Dropout + Noise)
+    // Processing chain: Apply dropout and tape noise after wow/flutter modulation
+    // Dropout checks land on exact sample positions; noise is counter-based (block-size independent)
+    const auto seed = static_cast<uint32_t>(parameters.getRawParameterValue("seed")->load());
+    if (seed != currentSeed)
     {
-        // One-pole lowpass filter coefficient for ~8kHz cutoff (architecture.md line 125)
-        // Formula: coeff = 1 - exp(-2π * cutoffFreq / sampleRate)
-        const float cutoffFreq = 8000.0f;
-        const float filterCoeff = 1.0f - std::exp(-juce::MathConstants<float>::twoPi * cutoffFreq / static_cast<float>(currentSampleRate));
-
-        for (int channel = 0; channel < numChannels; ++channel)
-        {
-            auto* channelData = buffer.getWritePointer(channel);
-
-            for (int sample = 0; sample < numSamples; ++sample)
-            {
-                // Generate white noise: range [-1.0, 1.0]
-                float whiteNoise = random.nextFloat() * 2.0f - 1.0f;
-
-                // Apply one-pole lowpass filter (simulates tape frequency response)
-                noiseFilterState[channel] += filterCoeff * (whiteNoise - noiseFilterState[channel]);
-
-                // Add filtered noise at very low amplitude
-                channelData[sample] += noiseFilterState[channel] * noiseGain;
-            }
-        }
+        currentSeed = seed;
+        degradation.setSeed(seed);
     }
 
+    degradation.process(buffer.getWritePointer(0),
+                        numChannels > 1 ? buffer.getWritePointer(1) : nullptr,
+                        numSamples, age);
+
     // Phase 4.4: Mix dry/wet signals AFTER all processing
     // Equal-power crossfade with latency compensation
     dryWetMixer.mixWetSamples(block);
@@ -430,19 +320,8 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         buffer.applyGain(outputGain);
     }
 
-    // Phase 5.2: Calculate peak level for VU meter (AFTER output gain)
-    float peakLevel = 0.0f;
-    for (int channel = 0; channel < numChannels; ++channel)
-    {
-        float channelPeak = buffer.getMagnitude(channel, 0, numSamples);
-        peakLevel = std::max(peakLevel, channelPeak);
-    }
-
-    // Convert to dB and store atomically (clamp to -100dB minimum to avoid log(0))
-    float peakDb = peakLevel > 0.00001f
-        ? juce::Decibels::gainToDecibels(peakLevel)
-        : -100.0f;
-    outputLevel.store(peakDb, std::memory_order_relaxed);
+    // Phase 5.2: Update output meter (AFTER output gain)
+    outputMeter.process(buffer);
 }
 
 juce::AudioProcessorEditor* TapeAgeAudioProcessor::createEditor()
@@ -452,9 +331,8 @@ juce::AudioProcessorEditor* TapeAgeAudioProcessor::createEditor()
 
 void TapeAgeAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    // Debug logging
-    juce::File("/tmp/tapeage_debug.log").appendText(
-        juce::Time::getCurrentTime().toString(true, true) + " - getStateInformation called\n");
+    // Debug logging (async, off by default)
+    diagnostics->log("TapeAge", "getStateInformation called");
 
     auto state = parameters.copyState();
     std::unique_ptr<juce::XmlElement> xml(state.createXml());
@@ -463,10 +341,8 @@ void TapeAgeAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 
 void TapeAgeAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
-    // Debug logging
-    juce::File debugLog("/tmp/tapeage_debug.log");
-    debugLog.appendText(
-        juce::Time::getCurrentTime().toString(true, true) + " - setStateInformation called\n");
+    // Debug logging (async, off by default)
+    diagnostics->log("TapeAge", "setStateInformation called");
 
     std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
 
@@ -475,17 +351,30 @@ void TapeAgeAudioProcessor::setStateInformation(const void* data, int sizeInByte
         parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
 
         // Log parameter values after restoration
-        auto* driveParam = parameters.getRawParameterValue("drive");
-        auto* ageParam = parameters.getRawParameterValue("age");
-        auto* mixParam = parameters.getRawParameterValue("mix");
-
-        debugLog.appendText(
-            "  Parameters after restore - Drive: " + juce::String(driveParam->load()) +
-            ", Age: " + juce::String(ageParam->load()) +
-            ", Mix: " + juce::String(mixParam->load()) + "\n");
+        if (diagnostics->isEnabled())
+        {
+            auto* driveParam = parameters.getRawParameterValue("drive");
+            auto* ageParam = parameters.getRawParameterValue("age");
+            auto* mixParam = parameters.getRawParameterValue("mix");
+
+            diagnostics->log("TapeAge",
+                "Parameters after restore - Drive: " + juce::String(driveParam->load()) +
+                ", Age: " + juce::String(ageParam->load()) +
+                ", Mix: " + juce::String(mixParam->load()));
+        }
     }
 }
 
+float TapeAgeAudioProcessor::ageRolloffCoefficient(float cutoffHz) const
+{
+    // Bilinear one-pole gain, same response as IIR::Coefficients::makeFirstOrderLowPass
+    // but computed in place (no coefficient object allocation)
+    const float maxCutoff = static_cast<float>(currentSampleRate) * 0.49f;
+    const float n = std::tan(juce::MathConstants<float>::pi * juce::jmin(cutoffHz, maxCutoff)
+                             / static_cast<float>(currentSampleRate));
+    return n / (1.0f + n);
+}
+
 // Factory function
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
 {
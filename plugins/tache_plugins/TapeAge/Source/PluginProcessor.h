@@ -1,6 +1,11 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "TapeModulator.h"
+#include "TapeSaturation.h"
+#include "TapeDegradation.h"
+#include "DiagnosticsLog.h"
+#include "LevelMeter.h"
 
 class TapeAgeAudioProcessor : public juce::AudioProcessor
 {
@@ -33,30 +38,37 @@ public:
     // Public access to parameters (needed by PluginEditor for WebView attachments)
     juce::AudioProcessorValueTreeState parameters;
 
-    // Phase 5.2: Output Level Metering (public for PluginEditor access)
-    std::atomic<float> outputLevel { -100.0f };  // Peak level in dB (initialized to silence)
+    // Phase 5.2: Output Level Metering (public for PluginEditor access, lock-free snapshot)
+    LevelMeter outputMeter;
+
+    // Shared async diagnostics (one ring + writer thread per process, off by default)
+    juce::SharedResourcePointer<DiagnosticsLog> diagnostics;
 
 private:
     // DSP Components (declared BEFORE parameters for initialization order)
     juce::dsp::ProcessSpec currentSpec;
 
     // Phase 4.1: Core Saturation Processing
-    juce::dsp::Oversampling<float> oversampler { 2, 1, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple };
+    // Oversamplers for every factor (2x/4x/8x) and filter type (FIR/IIR), built up front,
+    // plus the tanh/hysteresis shapers
+    TapeSaturation saturation;
+
+    // Switches the saturation oversampler and updates the wet latency to match
+    void selectOversampler(int index);
 
-    // Phase 4.2: Wow/Flutter Modulation
-    juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> delayLine;
-    float lfoPhase[2] { 0.0f, 0.0f };  // Separate phase per channel for stereo width
-    float flutterPhase[2] { 0.0f, 0.0f };  // Secondary flutter LFO phase per channel (v1.1.0)
-    juce::Random random;
+    // Phase 4.2: Wow/Flutter Modulation (block-based: recursive LFOs + interleaved stereo delay)
+    TapeModulator wowFlutter;
     double currentSampleRate { 44100.0 };
 
-    // Phase 4.3: Degradation Features (Dropout + Noise + High-frequency Rolloff)
-    int dropoutCountdown { 0 };  // Samples until next dropout check
-    bool inDropout { false };  // Dropout state flag
-    int dropoutSamplesRemaining { 0 };  // Current dropout duration
-    float dropoutEnvelope { 1.0f };  // Smooth attack/release (1.0 = no attenuation)
-    float noiseFilterState[2] { 0.0f, 0.0f };  // One-pole lowpass filter state per channel
-    juce::dsp::IIR::Filter<float> ageFilter[2];  // High-frequency rolloff per channel (v1.1.0)
+    // Phase 4.3: Degradation Features (Dropout + Noise), deterministic per seed
+    TapeDegradation degradation;
+    uint32_t currentSeed { 0 };
+
+    // High-frequency rolloff (v1.1.0): TPT one-pole lowpass, coefficient ramped per sample
+    float ageFilterState[2] { 0.0f, 0.0f };
+    float ageFilterCoeff { 0.0f };      // g = tan(pi * fc / fs) / (1 + tan(...)), value reached at end of last block
+    bool ageFilterActive { false };
+    float ageRolloffCoefficient(float cutoffHz) const;
 
     // Phase 4.4: Dry/Wet Mixing
     juce::dsp::DryWetMixer<float> dryWetMixer { 20000 };  // Max latency: 192kHz * 0.1s delay line + oversampler
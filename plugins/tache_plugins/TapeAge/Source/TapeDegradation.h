@@ -0,0 +1,210 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Small xorshift32 generator for rare, sequential draws (dropout events, start phases)
+struct TapeRandom
+{
+    explicit TapeRandom(uint32_t seed = 1) { setSeed(seed); }
+
+    void setSeed(uint32_t seed) { state = mix(seed) | 1u; }  // Never zero
+
+    uint32_t next()
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    // Uniform [0, 1)
+    float nextFloat() { return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f); }
+
+    // lowbias32 integer hash (fixed shifts and multiplies only, vectorises cleanly)
+    static uint32_t mix(uint32_t x)
+    {
+        x ^= x >> 16;
+        x *= 0x7feb352du;
+        x ^= x >> 15;
+        x *= 0x846ca68bu;
+        x ^= x >> 16;
+        return x;
+    }
+
+    uint32_t state = 1;
+};
+
+// Deterministic tape degradation: dropouts + filtered hiss, driven by a seed.
+//
+// - Dropout checks run every 100ms at exact sample positions (independent of
+//   the host buffer size). Duration and depth are drawn once per event.
+// - Noise is counter-based: sample n of channel c is hash(n ^ key[c]), so the
+//   generator has no loop-carried state, the fill loop vectorises, and the
+//   output does not depend on how the host splits the timeline into blocks.
+// Same seed + same input = bit-identical output, e.g. for cached offline renders.
+class TapeDegradation
+{
+public:
+    void prepare(double newSampleRate, int maximumBlockSize)
+    {
+        sampleRate = newSampleRate;
+        checkInterval = juce::jmax(1, static_cast<int>(sampleRate * 0.1));  // 100ms (architecture.md line 116)
+
+        // Envelope attack/release time: 7.5ms, mid-range of 5-10ms (architecture.md line 118)
+        envelopeIncrement = static_cast<float>(1.0 / (sampleRate * 0.0075));
+
+        // One-pole lowpass for ~8kHz hiss (architecture.md line 125)
+        noiseFilterCoeff = static_cast<float>(1.0 - std::exp(-juce::MathConstants<double>::twoPi * 8000.0 / sampleRate));
+
+        noiseBuffer.assign(static_cast<size_t>(juce::jmax(1, maximumBlockSize)), 0.0f);
+
+        inDropout = false;
+        dropoutSamplesRemaining = 0;
+        dropoutEnvelope = 1.0f;
+        noiseFilterState[0] = 0.0f;
+        noiseFilterState[1] = 0.0f;
+        setSeed(seed);
+    }
+
+    // Restarts both random streams from the seed and re-aligns the dropout grid.
+    // Envelope and filter state carry over so a runtime seed change doesn't click.
+    void setSeed(uint32_t newSeed)
+    {
+        seed = newSeed;
+        eventRandom.setSeed(seed);
+        noiseKey[0] = TapeRandom::mix(seed ^ 0x68e31da4u);
+        noiseKey[1] = TapeRandom::mix(seed ^ 0xb5297a4du);
+        noiseCounter = 0;
+        checkCountdown = checkInterval;
+    }
+
+    uint32_t getSeed() const { return seed; }
+
+    // In place; right may be nullptr for mono buffers
+    void process(float* left, float* right, int numSamples, float age)
+    {
+        processDropouts(left, right, numSamples, age);
+
+        // Noise amplitude scaled by age: 0% = silent, 100% = -60dB
+        addNoise(left, 0, numSamples, age * 0.001f);
+        if (right != nullptr)
+            addNoise(right, 1, numSamples, age * 0.001f);
+
+        noiseCounter += static_cast<uint32_t>(numSamples);
+    }
+
+private:
+    void processDropouts(float* left, float* right, int numSamples, float age)
+    {
+        // Probability scaled by age (architecture.md line 38: rare events every 5-10 seconds at max age)
+        // At age=1.0, probability = 0.02 per 100ms check
+        const float dropoutProbability = age * 0.02f;
+
+        int sample = 0;
+        while (sample < numSamples)
+        {
+            const int segmentEnd = juce::jmin(numSamples, sample + checkCountdown);
+            applyEnvelope(left, right, sample, segmentEnd);
+
+            checkCountdown -= segmentEnd - sample;
+            sample = segmentEnd;
+
+            if (checkCountdown == 0)
+            {
+                checkCountdown = checkInterval;
+
+                // Always draw, so the event stream only depends on elapsed samples
+                const float roll = eventRandom.nextFloat();
+                if (roll < dropoutProbability && !inDropout)
+                {
+                    inDropout = true;
+                    // Duration 50-150ms, attenuation 0.1-0.3 (architecture.md lines 39-40)
+                    dropoutSamplesRemaining = juce::jmax(1, static_cast<int>(sampleRate * (0.05 + eventRandom.nextFloat() * 0.1)));
+                    dropoutTargetGain = 0.1f + eventRandom.nextFloat() * 0.2f;
+                }
+            }
+        }
+    }
+
+    // Per-sample envelope between two dropout checks, applied to both channels (stereo coherence)
+    void applyEnvelope(float* left, float* right, int start, int end)
+    {
+        for (int i = start; i < end; ++i)
+        {
+            if (inDropout)
+            {
+                // Attack: fade down to dropout gain, hold until the event ends
+                dropoutEnvelope = juce::jmax(dropoutTargetGain, dropoutEnvelope - envelopeIncrement);
+                if (--dropoutSamplesRemaining <= 0)
+                    inDropout = false;
+            }
+            else if (dropoutEnvelope < 1.0f)
+            {
+                // Release: fade back to full gain
+                dropoutEnvelope = juce::jmin(1.0f, dropoutEnvelope + envelopeIncrement);
+            }
+            else
+            {
+                return;  // Idle until the next check
+            }
+
+            left[i] *= dropoutEnvelope;
+            if (right != nullptr)
+                right[i] *= dropoutEnvelope;
+        }
+    }
+
+    void addNoise(float* data, int channel, int numSamples, float noiseGain)
+    {
+        if (noiseGain <= 0.0f)
+            return;
+
+        float* noise = noiseBuffer.data();
+        const uint32_t key = noiseKey[channel];
+        const uint32_t counter = noiseCounter;
+
+        for (int start = 0; start < numSamples; start += static_cast<int>(noiseBuffer.size()))
+        {
+            const int count = juce::jmin(static_cast<int>(noiseBuffer.size()), numSamples - start);
+
+            // White noise in [-1, 1): independent per sample, no state carried between iterations
+            for (int i = 0; i < count; ++i)
+            {
+                const uint32_t bits = TapeRandom::mix((counter + static_cast<uint32_t>(start + i)) ^ key);
+                noise[i] = static_cast<float>(static_cast<int32_t>(bits)) * (1.0f / 2147483648.0f);
+            }
+
+            // One-pole lowpass (simulates tape frequency response), added at very low amplitude
+            float state = noiseFilterState[channel];
+            float* out = data + start;
+            for (int i = 0; i < count; ++i)
+            {
+                state += noiseFilterCoeff * (noise[i] - state);
+                out[i] += state * noiseGain;
+            }
+            noiseFilterState[channel] = state;
+        }
+    }
+
+    double sampleRate = 44100.0;
+    uint32_t seed = 0;
+
+    // Dropout events
+    TapeRandom eventRandom;
+    int checkInterval = 4410;
+    int checkCountdown = 4410;  // Samples until next dropout check
+    bool inDropout = false;
+    int dropoutSamplesRemaining = 0;
+    float dropoutTargetGain = 1.0f;
+    float dropoutEnvelope = 1.0f;  // 1.0 = no attenuation
+    float envelopeIncrement = 0.003f;
+
+    // Tape hiss
+    uint32_t noiseKey[2] { 0, 0 };
+    uint32_t noiseCounter = 0;  // Absolute sample index since the last (re)seed
+    std::vector<float> noiseBuffer;
+    float noiseFilterCoeff = 0.5f;
+    float noiseFilterState[2] { 0.0f, 0.0f };
+};
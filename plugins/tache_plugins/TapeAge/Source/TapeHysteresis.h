@@ -0,0 +1,102 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <cmath>
+
+// Jiles-Atherton magnetic hysteresis, solved with a 2nd-order Runge-Kutta step
+// per (oversampled) sample. One instance per channel.
+//
+// Input is the applied field H (audio x drive gain), output the magnetisation M.
+// a = Ms / 3 gives the anhysteretic curve unity small-signal gain (Langevin
+// L(Q) ~ Q/3) and Ms = 1 saturates at full scale, so levels line up with the
+// tanh mode and the same makeup gain applies.
+class TapeHysteresis
+{
+public:
+    void prepare(double oversampledRate)
+    {
+        T = static_cast<float>(1.0 / oversampledRate);
+        reset();
+    }
+
+    void reset()
+    {
+        M_n1 = 0.0f;
+        H_n1 = 0.0f;
+        H_d_n1 = 0.0f;
+    }
+
+    void process(float* data, int numSamples, float driveGain, float makeupGain)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float H = data[i] * driveGain;
+
+            // Alpha-blended trapezoidal derivative (damps the Nyquist limit cycle)
+            const float H_d = (1.0f + derivAlpha) / T * (H - H_n1) - derivAlpha * H_d_n1;
+
+            // RK2 (midpoint) step
+            const float k1 = T * dMdt(M_n1, H_n1, H_d_n1);
+            const float k2 = T * dMdt(M_n1 + 0.5f * k1, 0.5f * (H + H_n1), 0.5f * (H_d + H_d_n1));
+            float M = M_n1 + k2;
+
+            // Ill-conditioned solver step (denominator near zero): restart from rest
+            if (! std::isfinite(M))
+                M = 0.0f;
+
+            M = juce::jlimit(-Ms, Ms, M);
+
+            M_n1 = M;
+            H_n1 = H;
+            H_d_n1 = H_d;
+
+            data[i] = M * makeupGain;
+        }
+    }
+
+private:
+    // Langevin function and derivative, with Taylor fallback near zero
+    static void langevin(float Q, float& L, float& Ld)
+    {
+        if (std::abs(Q) < 1.0e-3f)
+        {
+            L = Q / 3.0f;
+            Ld = 1.0f / 3.0f;
+            return;
+        }
+
+        const float cothQ = 1.0f / std::tanh(Q);
+        const float invQ = 1.0f / Q;
+        L = cothQ - invQ;
+        Ld = invQ * invQ - (cothQ * cothQ - 1.0f);  // 1/Q^2 - 1/sinh^2(Q)
+    }
+
+    float dMdt(float M, float H, float H_d) const
+    {
+        const float Q = (H + alpha * M) / a;
+        float L, Ld;
+        langevin(Q, L, Ld);
+
+        const float M_diff = Ms * L - M;
+        const float delta = H_d >= 0.0f ? 1.0f : -1.0f;
+        const float delta_M = (delta > 0.0f) == (M_diff > 0.0f) ? 1.0f : 0.0f;
+
+        const float irreversible = (1.0f - c) * delta_M * M_diff / ((1.0f - c) * delta * k - alpha * M_diff);
+        const float reversible = c * Ms / a * Ld;
+        const float dMdH = (irreversible + reversible) / (1.0f - c * alpha * Ms / a * Ld);
+
+        return dMdH * H_d;
+    }
+
+    // Model constants (tape-like values, normalised to full scale)
+    static constexpr float Ms = 1.0f;          // Saturation magnetisation
+    static constexpr float a = Ms / 3.0f;      // Anhysteretic shape
+    static constexpr float alpha = 1.6e-3f;    // Inter-domain coupling
+    static constexpr float k = 0.05f;          // Coercivity (loop width)
+    static constexpr float c = 0.7f;           // Reversibility
+    static constexpr float derivAlpha = 0.75f;
+
+    float T = 1.0f / 88200.0f;
+    float M_n1 = 0.0f;
+    float H_n1 = 0.0f;
+    float H_d_n1 = 0.0f;
+};
@@ -0,0 +1,148 @@
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <cmath>
+#include <memory>
+#include "TapeHysteresis.h"
+
+// TapeAge saturation stage: upsample -> tanh or hysteresis -> downsample.
+//
+// Owns one oversampler per selectable factor (2x/4x/8x) and filter type
+// (FIR/IIR), all built up front so switching never allocates on the audio
+// thread, plus the two hysteresis solvers. The processor and the benchmark
+// (Benchmark/SaturationBenchmark.cpp) both run this class, so measured
+// numbers are for the code the plugin ships.
+class TapeSaturation
+{
+public:
+    // Index = filterType * numOversamplingFactors + factorIndex (filterType 0 = FIR, 1 = IIR)
+    static constexpr int numOversamplingFactors = 3;
+    static constexpr int numOversamplers = numOversamplingFactors * 2;
+
+    TapeSaturation()
+    {
+        for (int filterType = 0; filterType < 2; ++filterType)
+        {
+            auto type = filterType == 0 ? juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple
+                                        : juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR;
+
+            for (int factorIndex = 0; factorIndex < numOversamplingFactors; ++factorIndex)
+            {
+                // factorIndex + 1 stages: 2x, 4x, 8x
+                oversamplers[static_cast<size_t>(filterType * numOversamplingFactors + factorIndex)] =
+                    std::make_unique<juce::dsp::Oversampling<float>>(2, static_cast<size_t>(factorIndex + 1), type, true);
+            }
+        }
+    }
+
+    void prepare(double newSampleRate, int maximumBlockSize)
+    {
+        sampleRate = newSampleRate;
+
+        for (auto& oversampler : oversamplers)
+        {
+            oversampler->initProcessing(static_cast<size_t>(maximumBlockSize));
+            oversampler->reset();
+        }
+
+        selectOversampler(activeOversampler);
+    }
+
+    void reset()
+    {
+        for (auto& oversampler : oversamplers)
+            oversampler->reset();
+    }
+
+    // Also sets the hysteresis step size for the new oversampled rate
+    void selectOversampler(int index)
+    {
+        activeOversampler = juce::jlimit(0, numOversamplers - 1, index);
+        auto& oversampler = *oversamplers[static_cast<size_t>(activeOversampler)];
+        oversampler.reset();
+
+        for (auto& solver : hysteresis)
+            solver.prepare(sampleRate * static_cast<double>(oversampler.getOversamplingFactor()));
+    }
+
+    int getActiveOversampler() const { return activeOversampler; }
+
+    int getLatencyInSamples() const
+    {
+        return static_cast<int>(oversamplers[static_cast<size_t>(activeOversampler)]->getLatencyInSamples());
+    }
+
+    int getOversamplingFactor() const
+    {
+        return static_cast<int>(oversamplers[static_cast<size_t>(activeOversampler)]->getOversamplingFactor());
+    }
+
+    // Progressive drive curve (architecture.md):
+    // 0-30%: Very subtle (multiply by 1-2 before the shaper)
+    // 30-70%: Moderate warmth (multiply by 2-8)
+    // 70-100%: Heavy saturation (multiply by 8-20)
+    static float driveToGain(float drive)
+    {
+        if (drive <= 0.3f)
+            return 1.0f + (drive / 0.3f) * 1.0f;
+
+        if (drive <= 0.7f)
+            return 2.0f + ((drive - 0.3f) / 0.4f) * 6.0f;
+
+        return 8.0f + ((drive - 0.7f) / 0.3f) * 12.0f;
+    }
+
+    // In place, at the host rate
+    void process(juce::dsp::AudioBlock<float>& block, float drive, bool useHysteresis)
+    {
+        // Clear stale magnetisation when the mode is re-engaged
+        if (useHysteresis && ! hysteresisWasActive)
+        {
+            for (auto& solver : hysteresis)
+                solver.reset();
+        }
+        hysteresisWasActive = useHysteresis;
+
+        const float gain = driveToGain(drive);
+
+        // Makeup gain keeps perceived loudness roughly constant (v1.1.0)
+        const float makeupGain = 1.0f / std::sqrt(gain);
+
+        auto& oversampler = *oversamplers[static_cast<size_t>(activeOversampler)];
+        auto oversampledBlock = oversampler.processSamplesUp(block);
+
+        for (size_t channel = 0; channel < oversampledBlock.getNumChannels(); ++channel)
+        {
+            auto* channelData = oversampledBlock.getChannelPointer(channel);
+            const int numOversampledSamples = static_cast<int>(oversampledBlock.getNumSamples());
+
+            if (useHysteresis && channel < 2)
+            {
+                // Jiles-Atherton hysteresis (RK2 per oversampled sample)
+                hysteresis[channel].process(channelData, numOversampledSamples, gain, makeupGain);
+            }
+            else
+            {
+                processTanh(channelData, numOversampledSamples, gain, makeupGain);
+            }
+        }
+
+        oversampler.processSamplesDown(block);
+    }
+
+    static void processTanh(float* data, int numSamples, float gain, float makeupGain)
+    {
+        for (int sample = 0; sample < numSamples; ++sample)
+            data[sample] = std::tanh(gain * data[sample]) * makeupGain;
+    }
+
+private:
+    double sampleRate = 44100.0;
+
+    std::array<std::unique_ptr<juce::dsp::Oversampling<float>>, numOversamplers> oversamplers;
+    int activeOversampler = 0;
+
+    // Hysteresis saturation mode (one solver per channel, runs at the oversampled rate)
+    TapeHysteresis hysteresis[2];
+    bool hysteresisWasActive = false;
+};